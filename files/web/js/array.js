@@ -60,4 +60,59 @@ Array.prototype.join = function(separator = ""){
  */
 Array.prototype.empty = function(){
     return this.length === 0;
-}
\ No newline at end of file
+}
+
+/**
+ * @function regexSetMatch
+ * @memberof Array.prototype
+ * @description
+ * Versão em lote do String.prototype.regexSetMatch: testa cada string do array contra todos os padrões,
+ * compilando o conjunto de padrões uma única vez.
+ *
+ * @param {Array<string|RegExp>} patterns Padrões a serem testados.
+ * @returns {Array<Array<{match: boolean, start: number, end: number}>>} Um array de resultados para cada string do array.
+ */
+Array.prototype.regexSetMatch = function(patterns){
+    return callUserFunc.sync("regexSetMatch", this, patterns);
+}
+
+/**
+ * @function collationOrder
+ * @memberof Array.prototype
+ * @description
+ * Calcula a ordem alfabética das strings do array segundo as regras do português do Brasil (collation ICU pt-BR),
+ * sem alterar o array. As chaves de ordenação são geradas uma única vez no backend C++, então é bem mais rápido
+ * que ordenar com localeCompare, que compara as strings par a par.
+ *
+ * @returns {Array<number>} Permutação dos índices: o i-ésimo elemento é o índice da i-ésima string em ordem alfabética.
+ */
+Array.prototype.collationOrder = function(){
+    return callUserFunc.sync("collationOrder", this);
+}
+
+/**
+ * @function collationSort
+ * @memberof Array.prototype
+ * @description
+ * Retorna uma cópia do array ordenada alfabeticamente segundo as regras do português do Brasil.
+ * Strings equivalentes mantêm a ordem original.
+ *
+ * @returns {Array<string>} Novo array com as strings em ordem alfabética.
+ */
+Array.prototype.collationSort = function(){
+    return this.collationOrder().map(index => this[index]);
+}
+
+/**
+ * @function isAlpha
+ * @memberof Array.prototype
+ * @description
+ * Versão em lote do String.prototype.isAlpha: verifica, em uma única chamada ao backend, se cada string
+ * do array contém apenas caracteres alfabéticos do conjunto de letras informado.
+ *
+ * @param {"ascii"|"latin"|"any"} [script="ascii"] Conjunto de letras aceitas.
+ * @returns {Array<boolean>} Resultado de cada string, na mesma ordem do array.
+ */
+Array.prototype.isAlpha = function(script = "ascii"){
+    return callUserFunc.sync("checkAlphaCharactersArray", this, script);
+}
@@ -207,13 +207,15 @@ String.prototype.removeExtraLineBreaks = function(normalize = true){
  * @function isAlpha
  * @memberof String.prototype
  * @description
- * Verifica se a string contém apenas caracteres alfabéticos (A-Z, a-z).
- * Retorna true se todos os caracteres são letras, false caso contrário.
+ * Verifica se a string contém apenas caracteres alfabéticos do conjunto de letras informado.
+ * Por padrão aceita apenas A-Z e a-z; com "latin" aceita também letras acentuadas (á, ç, ...) e com "any"
+ * letras de qualquer escrita. Retorna true se todos os caracteres são letras, false caso contrário.
  * 
+ * @param {"ascii"|"latin"|"any"} [script="ascii"] Conjunto de letras aceitas.
  * @returns {boolean} true se todos os caracteres são letras, false caso contrário.
  */
-String.prototype.isAlpha = function(){
-    return callUserFunc.sync("checkAlphaCharacters", this.toString());
+String.prototype.isAlpha = function(script = "ascii"){
+    return callUserFunc.sync("checkAlphaCharacters", this.toString(), script);
 }
 
 /**
@@ -417,6 +419,7 @@ String.prototype.split = function(separator = "", limit){
  * @description
  * Substitui a primeira ocorrência do padrão informado por outro valor.
  * Suporta busca por string ou expressão regular.
+ * Assim como no JS, uma string de busca vazia insere o replaceValue na posição offset.
  * 
  * @param {string|RegExp} search Valor ou padrão a ser substituído.
  * @param {string} replaceValue Valor de substituição.
@@ -433,6 +436,8 @@ String.prototype.replace = function(search, replaceValue, offset = 0){
  * @description
  * Substitui todas as ocorrências do padrão informado por outro valor.
  * Suporta busca por string ou expressão regular.
+ * Assim como no JS, uma string de busca vazia insere o replaceValue entre todos os caracteres, incluindo o início
+ * e o fim (a partir de offset e respeitando limit): "abc".replaceAll("", "-") resulta em "-a-b-c-".
  * 
  * @param {string|RegExp} search Valor ou padrão a ser substituído.
  * @param {string} replaceValue Valor de substituição.
@@ -475,6 +480,21 @@ String.prototype.preg_split = function(search, limit){
     return callUserFunc.sync("preg_split", this.toString(), search, limit);
 }
 
+/**
+ * @function regexSetMatch
+ * @memberof String.prototype
+ * @description
+ * Testa a string contra vários padrões regex (PCRE2, sintaxe PHP) de uma só vez, em uma única passada.
+ * Mais rápido do que chamar preg_match/search uma vez para cada padrão.
+ * 
+ * @param {Array<string|RegExp>} patterns Padrões a serem testados.
+ * @returns {Array<{match: boolean, start: number, end: number}>} Um resultado por padrão, na mesma ordem,
+ * com as posições (em UTF-16) do primeiro match de cada um, ou -1 se não houve match.
+ */
+String.prototype.regexSetMatch = function(patterns){
+    return callUserFunc.sync("regexSetMatch", this.toString(), patterns);
+}
+
 /**
  * @function search
  * @memberof String.prototype
@@ -499,7 +519,8 @@ String.prototype.search = function(search){
  * todos os índices de matches do padrão especificado (string ou RegExp) na string original.
  *
  * O parâmetro opcional limit define o número máximo de matches que serão retornados.
- * Se o padrão for uma string, ele será convertido automaticamente para uma expressão regular.
+ * Se o padrão for uma string, ele é buscado como texto literal (caracteres como . ou * não têm
+ * significado especial). Para buscar por regex, use um RegExp.
  *
  * @param {string|RegExp} search  Padrão a ser buscado (string ou expressão regular).
  * @param {number} [limit]        (Opcional) Limite máximo de índices a retornar.
@@ -520,4 +541,21 @@ String.prototype.searchAll = function(search, limit){
  */
 String.prototype.visibleLength = function(){
     return callUserFunc.sync("VisibleLength", this.toString());
+}
+
+/**
+ * @function similarWords
+ * @memberof String.prototype
+ * @description
+ * Procura no dicionário as palavras parecidas com a string, isto é, com distância de edição (Levenshtein,
+ * em code points Unicode) de no máximo maxDistance. Útil para avisar sobre palavras quase duplicadas,
+ * como "CACHORRO" e "CAHORRO". As palavras são comparadas como estão, então normalize a string e o dicionário
+ * da mesma forma antes de chamar (ex: normalizeWord).
+ * 
+ * @param {Array<string>} dictionary Palavras a serem comparadas.
+ * @param {number} [maxDistance=2] Distância máxima para uma palavra ser considerada parecida.
+ * @returns {Array<{word: string, index: number, distance: number}>} Palavras parecidas, ordenadas pela distância.
+ */
+String.prototype.similarWords = function(dictionary, maxDistance){
+    return callUserFunc.sync("similarWords", this.toString(), dictionary, maxDistance);
 }
\ No newline at end of file
@@ -4,11 +4,17 @@
 #define PCRE2_CODE_UNIT_WIDTH 8
 #include <pcre2.h>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
 #include <algorithm> // Para usar o std::find
 #include <memory>  // Para gerenciamento de memória com unique_ptr
 #include <limits>
+#include <list>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+#include <stdexcept>
 
 namespace forcaRegex {
 
@@ -21,7 +27,9 @@ namespace forcaRegex {
      * @member  pattern      Ponteiro PCRE2 para o padrão
      * @member  length      Tamanho do padrão em bytes
      * @member  options     Flags de compilação (PCRE2_CASELESS, PCRE2_MULTILINE, etc)
-     * @member  compiled    Sub-estrutura que mantém o código compilado e informações de erro
+     * @member  names       Tabela nome -> número dos grupos nomeados, ordenada por nome
+     * @member  compiled    Sub-estrutura que mantém o código compilado, informações de erro,
+     *                      a quantidade de grupos de captura e se o padrão também foi compilado pelo JIT
      */
     struct RegexPattern {
         
@@ -29,13 +37,17 @@ namespace forcaRegex {
         PCRE2_SPTR pattern;
         PCRE2_SIZE length;
         uint32_t options;
+
+        std::vector< std::pair<std::string, uint32_t> > names;
         
         struct RegexCompile {
 
             int error_code = 0;
             PCRE2_SIZE error_offset = 0;
             pcre2_compile_context *context = nullptr;
-            pcre2_code *code;
+            pcre2_code *code = nullptr;
+            uint32_t captures = 0;
+            bool jit = false;
 
             // Destrutor para garantir a liberação da memória.
             ~RegexCompile() {
@@ -51,30 +63,153 @@ namespace forcaRegex {
     };
 
     /**
-     * Estrutura que gerencia os dados de match do PCRE2.
-     * Responsável por alocar e liberar a memória dos matches.
+     * Pool global de pilhas do JIT do PCRE2.
+     * 
+     * O código gerado pelo JIT precisa de uma pilha própria. Cada thread pega uma pilha
+     * do pool na primeira execução via JIT e devolve quando termina, assim as pilhas são
+     * reaproveitadas entre threads sem precisar alocar uma nova a cada match.
+     * 
+     * @struct  RegexJITStackPool
+     * @method  acquire     Retorna uma pilha livre do pool ou cria uma nova
+     * @method  release     Devolve a pilha ao pool (ou libera, se o pool estiver cheio)
+     */
+    struct RegexJITStackPool {
+
+        private:
+
+            std::vector<pcre2_jit_stack*> stacks;
+
+            std::mutex mutex;
+
+        public:
+
+            // Tamanho inicial e máximo de cada pilha e quantidade máxima de pilhas ociosas no pool.
+            static constexpr PCRE2_SIZE START_SIZE = 32 * 1024;
+            static constexpr PCRE2_SIZE MAX_SIZE = 1024 * 1024;
+            static constexpr std::size_t MAX_IDLE = 4;
+
+            pcre2_jit_stack* acquire();
+
+            void release( pcre2_jit_stack* stack );
+
+    };
+
+    /**
+     * Limites de execução de um match, aplicados pelo match context do PCRE2.
+     * Garantem um tempo máximo para cada chamada, mesmo com padrões que fazem backtracking catastrófico.
+     * 
+     * - match: quantidade máxima de chamadas internas do match (vale para o JIT e para o interpretador)
+     * - depth: profundidade máxima de backtracking (somente interpretador)
+     * - heap:  memória máxima, em KiB, para guardar o backtracking (somente interpretador)
      * 
-     * @struct  RegexMatchData
-     * @member  gcontext     Contexto geral do PCRE2 para alocação
-     * @member  match_data   Dados dos matches encontrados
+     * @struct  RegexLimits
      */
-    struct RegexMatchData {
+    struct RegexLimits {
+
+        static constexpr uint32_t DEFAULT_MATCH = 5000000;
+        static constexpr uint32_t DEFAULT_DEPTH = 250000;
+        static constexpr uint32_t DEFAULT_HEAP = 64 * 1024;
+
+        uint32_t match = DEFAULT_MATCH;
+
+        uint32_t depth = DEFAULT_DEPTH;
+
+        uint32_t heap = DEFAULT_HEAP;
+
+    };
+
+    /**
+     * Exceção lançada quando um match estoura algum dos limites de execução (RegexLimits).
+     * 
+     * @class   RegexLimitError
+     * @member  code    Código de erro do PCRE2 (PCRE2_ERROR_MATCHLIMIT, PCRE2_ERROR_DEPTHLIMIT ou PCRE2_ERROR_HEAPLIMIT)
+     */
+    class RegexLimitError : public std::runtime_error {
+
+        public:
+
+            const int code;
+
+            RegexLimitError( const std::string& message, int code ) : std::runtime_error(message), code(code) {}
+
+    };
+
+    /**
+     * Contexto de execução de regex de cada thread, reaproveitado entre as chamadas.
+     * Mantém o general context, o match context (com a pilha do JIT já associada) e um
+     * único bloco de match_data, que só é realocado quando aparece um padrão com mais
+     * grupos de captura do que o maior já visto pela thread. Assim, depois que a thread
+     * "aquece", o loop de match não faz nenhuma alocação no heap.
+     * 
+     * O bloco retornado por matchData() só é válido até a próxima chamada na mesma thread.
+     * 
+     * @struct  RegexThreadContext
+     * @member  gcontext     General context usado para alocar o match_data
+     * @member  mcontext     Match context da thread
+     * @member  jit_stack    Pilha do JIT emprestada do pool (nullptr até o primeiro match via JIT)
+     * @member  match_data   Bloco de match_data reaproveitado
+     * @member  pairs        Quantidade de pares (início, fim) que cabem no match_data
+     * @member  limits       Limites da chamada atual (RegexLimitsScope), ou nullptr para usar os limites globais
+     * @method  matchData    Retorna o match_data com espaço para todos os grupos do padrão
+     */
+    struct RegexThreadContext {
 
         pcre2_general_context *gcontext = nullptr;
-        
+
+        pcre2_match_context *mcontext = nullptr;
+
+        pcre2_jit_stack *jit_stack = nullptr;
+
         pcre2_match_data *match_data = nullptr;
 
-        // Destrutor para garantir a liberação da memória.
-        ~RegexMatchData() {
+        uint32_t pairs = 0;
 
-            if( match_data != nullptr ) pcre2_match_data_free(match_data);
+        const forcaRegex::RegexLimits *limits = nullptr;
 
-            if( gcontext != nullptr ) pcre2_general_context_free(gcontext);
+        RegexThreadContext();
 
-        }
+        pcre2_match_data* matchData( const forcaRegex::RegexPattern& pattern );
+
+        ~RegexThreadContext();
+
+        RegexThreadContext( const RegexThreadContext& ) = delete;
+
+        RegexThreadContext& operator=( const RegexThreadContext& ) = delete;
+
+    };
+
+    /**
+     * Aplica limites de execução próprios em todas as funções preg_* chamadas pela thread atual
+     * enquanto o objeto existir, no lugar dos limites globais. Os escopos podem ser aninhados.
+     * 
+     * Exemplo:
+     *     {
+     *         forcaRegex::RegexLimitsScope scope( forcaRegex::RegexLimits{ 100000, 1000, 1024 } );
+     *         forcaRegex::preg_replace(pattern, subject, "");
+     *     }
+     * 
+     * @struct  RegexLimitsScope
+     */
+    struct RegexLimitsScope {
+
+        private:
+
+            forcaRegex::RegexLimits limits;
+
+            const forcaRegex::RegexLimits *previous;
+
+        public:
+
+            explicit RegexLimitsScope( const forcaRegex::RegexLimits& limits );
+
+            ~RegexLimitsScope();
+
+            RegexLimitsScope( const RegexLimitsScope& ) = delete;
+
+            RegexLimitsScope& operator=( const RegexLimitsScope& ) = delete;
 
     };
-    
+
     /**
      * Estrutura que armazena informações sobre um match específico.
      * Mantém a posição inicial, final e o texto encontrado.
@@ -124,6 +259,9 @@ namespace forcaRegex {
 
             std::string trim( const std::string& string ){
 
+                // A grande maioria das chaves já chega sem espaços, então evita a cópia caractere a caractere.
+                if( string.empty() || ( !isspace( static_cast<unsigned char>(string.front()) ) && !isspace( static_cast<unsigned char>(string.back()) ) ) ) return string;
+
                 std::string newString = string;
 
                 // Removendo espaços a esquerda.
@@ -234,16 +372,466 @@ namespace forcaRegex {
 
     };
 
+    /**
+     * Estatísticas de uso do cache de padrões compilados.
+     * 
+     * @struct  RegexCacheStats
+     * @member  hits        Quantidade de buscas que encontraram o padrão já compilado
+     * @member  misses      Quantidade de buscas que precisaram compilar o padrão
+     * @member  evictions   Quantidade de padrões removidos por falta de espaço (LRU)
+     * @member  size        Quantidade de padrões armazenados no momento
+     * @member  capacity    Quantidade máxima de padrões armazenados
+     * @member  pinned      Quantidade de padrões fixos (fora do LRU), como os padrões internos pré-compilados
+     */
+    struct RegexCacheStats {
+
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        std::size_t evictions = 0;
+        std::size_t size = 0;
+        std::size_t capacity = 0;
+        std::size_t pinned = 0;
+
+    };
+
+    /**
+     * Cache thread-safe de padrões regex compilados, com política de remoção LRU
+     * (o padrão usado há mais tempo é o primeiro a sair quando o cache está cheio).
+     * 
+     * A chave é o pattern exatamente como foi recebido (ex: "/regex/u"), assim o
+     * parse dos delimitadores/flags e o pcre2_compile só acontecem uma vez por padrão.
+     * A compilação é feita com o mutex travado, garantindo que um mesmo padrão nunca
+     * seja compilado duas vezes, mesmo com várias threads pedindo ao mesmo tempo.
+     * 
+     * Os padrões são entregues como std::shared_ptr, então um padrão removido do cache
+     * continua válido para quem ainda estiver usando ele.
+     * 
+     * @struct  RegexPatternCache
+     * @method  get          Retorna o padrão compilado, compilando e armazenando se necessário
+     * @method  pin          Armazena um padrão já compilado que nunca é removido do cache
+     * @method  pinnedPattern Retorna um padrão fixo, ou nullptr se não existir
+     * @method  setCapacity  Altera a capacidade máxima do cache
+     * @method  clear        Remove todos os padrões do cache
+     * @method  stats        Retorna as estatísticas de uso do cache
+     */
+    struct RegexPatternCache {
+
+        private:
+
+            typedef std::list<std::string> UsageList;
+
+            struct CacheEntry {
+
+                std::shared_ptr<const forcaRegex::RegexPattern> pattern;
+
+                UsageList::iterator usage;
+
+            };
+
+            // Chaves ordenadas por uso, a mais recente fica no começo da lista.
+            UsageList usage;
+
+            std::unordered_map< std::string, CacheEntry > entries;
+
+            // Padrões fixos, que não contam na capacidade e nunca são removidos.
+            std::unordered_map< std::string, std::shared_ptr<const forcaRegex::RegexPattern> > pinned;
+
+            std::size_t capacity;
+
+            std::size_t hits = 0;
+
+            std::size_t misses = 0;
+
+            std::size_t evictions = 0;
+
+            std::mutex mutex;
+
+            void evict();
+
+        public:
+
+            explicit RegexPatternCache( std::size_t capacity = 64 );
+
+            std::shared_ptr<const forcaRegex::RegexPattern> get( const std::string& pattern );
+
+            void pin( const std::string& pattern, std::shared_ptr<const forcaRegex::RegexPattern> compiled );
+
+            std::shared_ptr<const forcaRegex::RegexPattern> pinnedPattern( const std::string& pattern );
+
+            void setCapacity( std::size_t capacity );
+
+            void clear();
+
+            forcaRegex::RegexCacheStats stats();
+
+    };
+
+    /**
+     * Resultado "flat" e sem cópias de uma busca regex.
+     * 
+     * Diferente do RegexResult, não copia nenhuma captura: guarda apenas os pares (início, fim)
+     * de cada grupo em um único vetor contíguo, organizado por grupo (todos os matches do
+     * grupo 0, depois todos do grupo 1, etc). As capturas são expostas como std::string_view
+     * apontando para o subject original e só são copiadas quando pedido (copy()).
+     * Os grupos nomeados usam a tabela nome -> número montada uma única vez na compilação do padrão.
+     * 
+     * IMPORTANTE: as views apontam para o subject passado na busca, então o subject precisa
+     * continuar vivo (e sem alterações) enquanto o resultado for usado.
+     * 
+     * Grupos que não participaram de um match têm início e fim iguais a PCRE2_UNSET.
+     * 
+     * @struct  RegexMatches
+     * @method  size        Quantidade de matches encontrados
+     * @method  groupCount  Quantidade de grupos (grupo 0 + grupos de captura)
+     * @method  groupIndex  Número de um grupo nomeado, ou -1 se não existir
+     * @method  isset       Verifica se o grupo participou do match
+     * @method  start       Posição inicial (em bytes) do grupo no match
+     * @method  end         Posição final (em bytes) do grupo no match
+     * @method  view        Captura como std::string_view (vazia se o grupo não participou)
+     * @method  copy        Captura copiada para uma std::string
+     * @method  toResult    Materializa o resultado no formato antigo (RegexResult)
+     * @member  match       Flag indicando se houve match
+     */
+    struct RegexMatches {
+
+        private:
+
+            std::shared_ptr<const forcaRegex::RegexPattern> pattern;
+
+            std::string_view subject;
+
+            std::vector<PCRE2_SIZE> offsets;
+
+            std::size_t matches = 0;
+
+            uint32_t groups = 0;
+
+            bool transposed = false;
+
+        public:
+
+            bool match = false;
+
+            RegexMatches() = default;
+
+            RegexMatches( std::shared_ptr<const forcaRegex::RegexPattern> pattern, std::string_view subject );
+
+            void append( const PCRE2_SIZE* ovector, int count );
+
+            void finalize();
+
+            std::size_t size() const { return matches; }
+
+            uint32_t groupCount() const { return groups; }
+
+            int groupIndex( std::string_view name ) const;
+
+            PCRE2_SIZE start( uint32_t group, std::size_t index = 0 ) const {
+
+                return ( group < groups && index < matches ) ? offsets[ ( group * matches + index ) * 2 ] : PCRE2_UNSET;
+
+            }
+
+            PCRE2_SIZE end( uint32_t group, std::size_t index = 0 ) const {
+
+                return ( group < groups && index < matches ) ? offsets[ ( group * matches + index ) * 2 + 1 ] : PCRE2_UNSET;
+
+            }
+
+            bool isset( uint32_t group, std::size_t index = 0 ) const {
+
+                return start(group, index) != PCRE2_UNSET;
+
+            }
+
+            std::string_view view( uint32_t group, std::size_t index = 0 ) const {
+
+                PCRE2_SIZE begin = start(group, index);
+
+                if( begin == PCRE2_UNSET ) return std::string_view();
+
+                return subject.substr( begin, end(group, index) - begin );
+
+            }
+
+            std::string copy( uint32_t group, std::size_t index = 0 ) const {
+
+                return std::string( view(group, index) );
+
+            }
+
+            forcaRegex::RegexResult toResult() const;
+
+    };
+
+    /**
+     * Texto de substituição do preg_replace pré-processado em uma lista de tokens.
+     * 
+     * O replacement é lido uma única vez e dividido em trechos literais e referências a grupos
+     * ($0, $1, $10, ${1}, $name, ${name}). As referências são resolvidas contra o padrão na
+     * criação, então na hora de substituir basta percorrer os tokens.
+     * 
+     * Regras de resolução:
+     * - $nn usa até dois dígitos, preferindo o número de dois dígitos se o grupo existir ($10 com 10 grupos,
+     *   senão $1 seguido do literal "0")
+     * - $name usa o maior nome de grupo existente que seja prefixo do identificador
+     * - ${...} delimita a referência explicitamente
+     * - Referências a grupos inexistentes ficam como texto literal
+     * 
+     * @struct  RegexReplacement
+     * @method  length      Tamanho exato da substituição de um match
+     * @method  appendTo    Escreve a substituição de um match no buffer de saída
+     * @member  text        Cópia do replacement original (os literais apontam para ela)
+     * @member  tokens      Lista de tokens (literal ou grupo)
+     * @member  literals    Soma do tamanho de todos os literais
+     */
+    struct RegexReplacement {
+
+        struct Token {
+
+            std::size_t start = 0;
+            std::size_t length = 0;
+            int group = -1; // -1 para literal
+
+        };
+
+        std::string text;
+
+        std::vector<Token> tokens;
+
+        std::size_t literals = 0;
+
+        RegexReplacement( const forcaRegex::RegexPattern& pattern, const std::string& replacement );
+
+        std::size_t length( const forcaRegex::RegexMatches& matches, std::size_t index ) const;
+
+        void appendTo( std::string& output, const forcaRegex::RegexMatches& matches, std::size_t index ) const;
+
+    };
+
+    /**
+     * Padrão regex literal (no formato /pattern/flags ou #pattern#flags) validado em tempo de compilação.
+     * 
+     * Quando declarado como constexpr, o construtor separa a expressão e as flags e valida os
+     * delimitadores e as flags durante o build: um padrão malformado vira erro de compilação.
+     * Usado junto com o StaticPattern, que compila o padrão uma única vez por processo.
+     * 
+     * Diferente do createPattern(), não aceita espaços antes/depois do padrão nem flags desconhecidas.
+     * 
+     * Exemplo:
+     *     inline constexpr forcaRegex::PatternLiteral DIGITS("/\\d+/u");
+     * 
+     * @struct  PatternLiteral
+     * @member  source      Padrão completo, como escrito (também é a chave do cache)
+     * @member  expression  Expressão regular, sem os delimitadores
+     * @member  flags       Flags do padrão
+     * @member  options     Flags convertidas para as opções do PCRE2
+     */
+    struct PatternLiteral {
+
+        std::string_view source;
+
+        std::string_view expression;
+
+        std::string_view flags;
+
+        uint32_t options = 0;
+
+        template<std::size_t N>
+        constexpr PatternLiteral( const char (&literal)[N] ) : source( literal, N - 1 ) {
+
+            if( N - 1 < 3 || ( literal[0] != '/' && literal[0] != '#' ) ){
+                throw std::invalid_argument("Regex pattern malformado. O padrão deve começar com um delimitador ('/' ou '#') e ter no mínimo 3 caracteres.");
+            }
+
+            std::size_t lastDelimeter = N - 2;
+
+            while( lastDelimeter > 0 && literal[lastDelimeter] != literal[0] ) lastDelimeter--;
+
+            if( lastDelimeter < 2 ){
+                throw std::invalid_argument("Regex pattern malformado. O padrão não tem o delimitador de fechamento.");
+            }
+
+            expression = source.substr( 1, lastDelimeter - 1 );
+
+            flags = source.substr( lastDelimeter + 1 );
+
+            for( char flag : flags ){
+
+                switch( flag ){
+                    case 'i': options |= PCRE2_CASELESS; break;
+                    case 'm': options |= PCRE2_MULTILINE; break;
+                    case 's': options |= PCRE2_DOTALL; break;
+                    case 'u': options |= PCRE2_UTF; break;
+                    case 'x': options |= PCRE2_EXTENDED; break;
+                    case 'U': options |= PCRE2_UNGREEDY; break;
+                    case 'g': break; // Flag do JS, aceita para os padrões compartilhados com o front, sem efeito aqui.
+                    default:
+                        throw std::invalid_argument("Regex pattern malformado. Flag desconhecida.");
+                }
+
+            }
+
+        }
+
+    };
+
     std::unique_ptr<forcaRegex::RegexPattern> createPattern( const std::string& pattern );
 
+    std::unique_ptr<forcaRegex::RegexPattern> createPattern( const std::string& pattern, pcre2_code* code );
+
+    std::unique_ptr<forcaRegex::RegexPattern> createPattern( const forcaRegex::PatternLiteral& literal );
+
+    std::shared_ptr<const forcaRegex::RegexPattern> compileLiteral( const forcaRegex::PatternLiteral& literal );
+
+    forcaRegex::RegexPatternCache& patternCache();
+
+    bool jitAvailable();
+
+    void setJITEnabled( bool enabled );
+
+    bool isJITEnabled();
+
+    forcaRegex::RegexThreadContext& threadContext();
+
+    void setDefaultLimits( const forcaRegex::RegexLimits& limits );
+
+    forcaRegex::RegexLimits getDefaultLimits();
+
+    int executeMatch( const forcaRegex::RegexPattern& pattern, const std::string& subject, PCRE2_SIZE offset, pcre2_match_data *match_data );
+
+    std::shared_ptr<const forcaRegex::RegexPattern> getPattern( const std::string& pattern );
+
+    forcaRegex::RegexResult preg_match( const std::shared_ptr<const forcaRegex::RegexPattern>& pattern, const std::string& subject, PCRE2_SIZE offset = 0 );
+
     forcaRegex::RegexResult preg_match( const std::string& pattern, const std::string& subject, PCRE2_SIZE offset = 0 );
 
+    forcaRegex::RegexResult preg_match_all( const std::shared_ptr<const forcaRegex::RegexPattern>& pattern, const std::string& subject, PCRE2_SIZE offset = 0, std::size_t limit = std::numeric_limits<size_t>::max() );
+
     forcaRegex::RegexResult preg_match_all( const std::string& pattern, const std::string& subject, PCRE2_SIZE offset = 0, std::size_t limit = std::numeric_limits<size_t>::max() );
 
+    forcaRegex::RegexMatches preg_match_offsets( const std::shared_ptr<const forcaRegex::RegexPattern>& pattern, const std::string& subject, PCRE2_SIZE offset = 0 );
+
+    forcaRegex::RegexMatches preg_match_offsets( const std::string& pattern, const std::string& subject, PCRE2_SIZE offset = 0 );
+
+    forcaRegex::RegexMatches preg_match_all_offsets( const std::shared_ptr<const forcaRegex::RegexPattern>& pattern, const std::string& subject, PCRE2_SIZE offset = 0, std::size_t limit = std::numeric_limits<size_t>::max() );
+
+    forcaRegex::RegexMatches preg_match_all_offsets( const std::string& pattern, const std::string& subject, PCRE2_SIZE offset = 0, std::size_t limit = std::numeric_limits<size_t>::max() );
+
+    std::string preg_replace( const std::shared_ptr<const forcaRegex::RegexPattern>& pattern, const std::string& subject, const std::string& replacement, PCRE2_SIZE offset = 0, std::size_t limit = std::numeric_limits<size_t>::max() );
+
     std::string preg_replace( const std::string& pattern, const std::string& subject, const std::string& replacement, PCRE2_SIZE offset = 0, std::size_t limit = std::numeric_limits<size_t>::max() );
 
+    std::vector<std::string_view> preg_split_view( const std::shared_ptr<const forcaRegex::RegexPattern>& pattern, const std::string& subject, std::size_t limit = std::numeric_limits<size_t>::max() );
+
+    std::vector<std::string_view> preg_split_view( const std::string& pattern, const std::string& subject, std::size_t limit = std::numeric_limits<size_t>::max() );
+
+    std::vector<std::string> preg_split( const std::shared_ptr<const forcaRegex::RegexPattern>& pattern, const std::string& subject, std::size_t limit = std::numeric_limits<size_t>::max() );
+
     std::vector<std::string> preg_split( const std::string& pattern, const std::string& subject, std::size_t limit = std::numeric_limits<size_t>::max() );
 
+    /**
+     * Handle estático e compartilhado por todo o processo de um PatternLiteral.
+     * 
+     * O padrão é compilado (ou obtido do bundle de padrões internos) na primeira chamada de get()
+     * e o mesmo ponteiro é devolvido em todas as chamadas seguintes, sem parse, sem lookup no cache
+     * e sem nenhuma trava além da inicialização da variável estática.
+     * 
+     * Exemplo:
+     *     forcaRegex::preg_replace( forcaRegex::StaticPattern<forcaRegex::builtins::LINE_BREAK>::get(), text, "\n" );
+     * 
+     * @struct  StaticPattern
+     * @tparam  Literal     PatternLiteral constexpr com armazenamento estático
+     * @method  get         Retorna o padrão compilado
+     */
+    template<const forcaRegex::PatternLiteral& Literal>
+    struct StaticPattern {
+
+        static const std::shared_ptr<const forcaRegex::RegexPattern>& get() {
+
+            static const std::shared_ptr<const forcaRegex::RegexPattern> compiled = forcaRegex::compileLiteral(Literal);
+
+            return compiled;
+
+        }
+
+    };
+
+    /**
+     * Resultado de um padrão dentro de um RegexSet.
+     * 
+     * @struct  RegexSetMatch
+     * @member  match   Indica se o padrão teve match
+     * @member  start   Posição inicial (em bytes) do primeiro match do padrão, ou PCRE2_UNSET
+     * @member  end     Posição final (em bytes) do primeiro match do padrão, ou PCRE2_UNSET
+     */
+    struct RegexSetMatch {
+
+        bool match = false;
+
+        PCRE2_SIZE start = PCRE2_UNSET;
+
+        PCRE2_SIZE end = PCRE2_UNSET;
+
+    };
+
+    /**
+     * Conjunto de padrões no estilo PHP testados contra um subject em uma única passada.
+     * 
+     * Os padrões são combinados em um único programa: "(?:(?flags:p0)(?C'0')|(?flags:p1)(?C'1')|...)(*F)".
+     * Cada alternativa termina em um callout que registra o primeiro match daquele padrão, e o (*F)
+     * força o motor a continuar testando as outras alternativas, sem reler o subject a cada padrão.
+     * A busca é interrompida assim que todos os padrões tiverem match. O resultado de cada padrão
+     * é o mesmo que o preg_match() daquele padrão retornaria.
+     * 
+     * As flags i, m, s, x e U viram flags inline de cada alternativa. Padrões com a flag u ficam em um
+     * segundo programa combinado, compilado em modo UTF, para não mudar como os demais casam.
+     * Se a busca em um programa combinado falhar com um erro (ex: UTF-8 inválido) ou estourar um limite
+     * de execução (o backtracking completo do programa combinado pode estourar limites que os padrões
+     * sozinhos não estouram), os padrões dele são executados um a um, com o mesmo resultado (ou exceção) do preg_match().
+     * 
+     * Padrões que dependem da numeração dos grupos (backreferences, recursão), que usam verbos como
+     * (*UTF) ou (*COMMIT), callouts próprios ou \Q não podem ser combinados e são executados separadamente.
+     * 
+     * O programa combinado é guardado no cache de padrões, então criar o mesmo RegexSet de novo é barato.
+     * 
+     * @class   RegexSet
+     * @method  size    Quantidade de padrões do conjunto
+     * @method  match   Testa o subject contra todos os padrões
+     */
+    class RegexSet {
+
+        private:
+
+            std::size_t count = 0;
+
+            // Programa combinado, o índice original de cada alternativa e o padrão compilado sozinho de cada uma.
+            struct CombinedProgram {
+
+                std::shared_ptr<const forcaRegex::RegexPattern> pattern;
+
+                std::vector<std::size_t> index;
+
+                std::vector< std::shared_ptr<const forcaRegex::RegexPattern> > patterns;
+
+            };
+
+            // No máximo dois programas: um para os padrões sem a flag u e outro para os padrões com a flag u.
+            std::vector<CombinedProgram> combined;
+
+            // Padrões executados separadamente (índice original, padrão compilado).
+            std::vector< std::pair< std::size_t, std::shared_ptr<const forcaRegex::RegexPattern> > > separate;
+
+        public:
+
+            explicit RegexSet( const std::vector<std::string>& patterns );
+
+            std::size_t size() const { return count; }
+
+            std::vector<forcaRegex::RegexSetMatch> match( const std::string& subject, PCRE2_SIZE offset = 0 ) const;
+
+    };
+
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,55 @@
+#ifndef FORCA_REGEX_BUILTINS_H
+#define FORCA_REGEX_BUILTINS_H
+
+#include <cstddef>
+#include "forcaRegex.h"
+
+/**
+ * Padrões regex internos do jogo.
+ * 
+ * Estes padrões são compilados durante o build (tools/forcaRegexBundle.cpp), serializados com
+ * o pcre2_serialize_encode e embutidos no executável. Na primeira busca de qualquer padrão
+ * o bundle é decodificado de uma vez e os padrões ficam fixos no cache, sem nenhuma compilação.
+ * 
+ * Os padrões são PatternLiteral, então são validados em tempo de compilação, e podem ser usados
+ * diretamente com o StaticPattern. O source de cada um precisa ser exatamente igual à string usada
+ * nas chamadas por string (é a chave do cache).
+ * O WORD_FILTER, por exemplo, é o String() do RegExp usado no filterWordsArray do game.js.
+ * 
+ * @namespace   forcaRegex::builtins
+ */
+namespace forcaRegex {
+
+    namespace builtins {
+
+        // Qualquer quebra de linha (normalizeLineBreaks).
+        inline constexpr forcaRegex::PatternLiteral LINE_BREAK( R"(/(?:\r\n|\r|\n|\v|\f|\x85|\x0b|\p{Zl}|\p{Zp})/u)" );
+
+        // Sequência de quebras de linha (removeExtraLineBreaks com normalize).
+        inline constexpr forcaRegex::PatternLiteral LINE_BREAKS( R"(/(?:\r\n|\r|\n|\v|\f|\x85|\x0b|\p{Zl}|\p{Zp})+/u)" );
+
+        // Sequência de quebras de linha capturando a última (removeExtraLineBreaks sem normalize).
+        inline constexpr forcaRegex::PatternLiteral LINE_BREAKS_GROUP( R"(/((?:\r\n|\r|\n|\v|\f|\x85|\x0b|\p{Zl}|\p{Zp}))+/u)" );
+
+        // Tudo que não é letra do português (filterWordsArray, no game.js).
+        inline constexpr forcaRegex::PatternLiteral WORD_FILTER( "/[^a-záéíóúàèìòùâêîôûãõç]/giu" );
+
+        inline constexpr forcaRegex::PatternLiteral PATTERNS[] = {
+            LINE_BREAK,
+            LINE_BREAKS,
+            LINE_BREAKS_GROUP,
+            WORD_FILTER
+        };
+
+        inline constexpr std::size_t PATTERN_COUNT = sizeof(PATTERNS) / sizeof(PATTERNS[0]);
+
+        // Bundle serializado, gerado no build.
+        extern const unsigned char BUNDLE[];
+
+        extern const std::size_t BUNDLE_SIZE;
+
+    }
+
+}
+
+#endif
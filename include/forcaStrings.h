@@ -2,37 +2,71 @@
 #define FORCA_STRINGS_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <limits>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
 
 namespace forcaStrings {
 
+    bool isASCII( std::string_view string );
+
     std::string removeSpaces( const std::string& string );
 
     std::string normalize( const std::string& string, const std::string& form = "NFC" );
 
+    std::string normalize( std::string&& string, const std::string& form = "NFC" );
+
     std::string removeAcentos( const std::string& string );
 
     std::string to_uppercase( const std::string& string );
 
     std::string to_lowercase( const std::string& string );
 
+    void to_uppercase( std::string_view string, std::string& output );
+
+    void to_lowercase( std::string_view string, std::string& output );
+
     std::string trim( const std::string& string );
 
     std::string ltrim( const std::string& string );
 
     std::string rtrim( const std::string& string );
 
+    std::string_view trim_view( std::string_view string );
+
+    std::string_view ltrim_view( std::string_view string );
+
+    std::string_view rtrim_view( std::string_view string );
+
     std::string normalizeWord( const std::string& string );
 
     std::string normalizeLineBreaks( const std::string& text );
 
     std::string removeExtraLineBreaks( const std::string& text, bool normalize = true );
 
-    bool checkAlphaCharacters( const std::string& word );
+    /**
+     * Conjunto de letras aceitas por checkAlphaCharacters().
+     *
+     * ASCII aceita apenas A-Z e a-z; LATIN aceita qualquer letra Unicode da escrita latina (á, ç, ñ, ...);
+     * ANY aceita letras Unicode de qualquer escrita.
+     */
+    enum class AlphaScript { ASCII, LATIN, ANY };
+
+    AlphaScript alphaScriptFromName( const std::string& name );
+
+    bool checkAlphaCharacters( std::string_view word, AlphaScript script = AlphaScript::ASCII );
+
+    std::vector<bool> checkAlphaCharacters( const std::vector<std::string>& words, AlphaScript script = AlphaScript::ASCII );
 
     std::vector<std::string> explodeGraphemes( const std::string& string );
 
+    std::vector<std::uint32_t> graphemeBoundaries( std::string_view string );
+
+    std::string_view graphemeAt( std::string_view string, const std::vector<std::uint32_t>& boundaries, std::size_t index );
+
     std::string::size_type VisibleLength( const std::string& string );
 
     std::string::size_type Length( const std::string& string );
@@ -47,27 +81,201 @@ namespace forcaStrings {
 
     std::string::size_type lastIndexOf( const std::string& string, const std::string& search );
 
+    /**
+     * Índice das fronteiras de graphemes (caracteres visíveis) de uma string UTF-8.
+     *
+     * As fronteiras são calculadas uma única vez e guardadas como offsets em bytes em um único vetor contíguo,
+     * de modo que length, charAt, slice e indexOf são respondidos sem percorrer a string novamente.
+     * Os resultados são std::string_view apontando para a cópia da string mantida pelo próprio índice,
+     * válidos enquanto o índice existir e não for reconstruído.
+     */
+    class GraphemeIndex {
+
+        public:
+
+            GraphemeIndex();
+
+            explicit GraphemeIndex( const std::string& string );
+
+            void assign( const std::string& string );
+
+            const std::string& string() const { return text; }
+
+            std::string::size_type length() const { return boundaries.size() - 1; }
+
+            std::string::size_type offset( std::string::size_type index ) const;
+
+            std::string_view charAt( std::string::size_type index ) const;
+
+            std::string_view slice( std::string::size_type pos, std::string::size_type len = std::numeric_limits<size_t>::max() ) const;
+
+            std::string::size_type firstIndexOf( std::string_view search ) const;
+
+            std::string::size_type lastIndexOf( std::string_view search ) const;
+
+            // Tamanho máximo, em bytes, de uma string mantida no cache de cada thread.
+            static constexpr std::size_t CACHE_LIMIT = 16 * 1024;
+
+            static bool cacheable( const std::string& string ) { return string.length() <= CACHE_LIMIT; }
+
+            static const GraphemeIndex* cached( const std::string& string );
+
+            static const GraphemeIndex& cached( const std::string& string, GraphemeIndex& local );
+
+        private:
+
+            std::string text;
+
+            std::vector<std::uint32_t> boundaries;
+
+    };
+
     void explode( const std::string& string, const std::string& separator, std::vector<std::string>* reference, std::size_t limit = std::numeric_limits<size_t>::max() );
 
     void explode( char* string, const std::string& separator, std::vector<std::string>* reference, std::size_t limit = std::numeric_limits<size_t>::max() );
 
     void explode( const char* string, const std::string& separator, std::vector<std::string>* reference, std::size_t limit = std::numeric_limits<size_t>::max() );
 
+    /**
+     * Sequência preguiçosa dos pedaços de uma string dividida por um separador, com a mesma semântica de explode().
+     *
+     * Cada pedaço é um std::string_view sobre a string original, calculado apenas quando o iterador avança,
+     * então nenhuma cópia é feita. O limit é o número máximo de pedaços: o último contém o restante da string.
+     * Com separador vazio, a string é dividida em graphemes (caracteres visíveis), cujas fronteiras são calculadas
+     * uma única vez na criação do range. A string original deve continuar válida enquanto o range for usado.
+     */
+    class ExplodeRange {
+
+        public:
+
+            class iterator {
+
+                public:
+
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = std::string_view;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = const std::string_view*;
+                    using reference = const std::string_view&;
+
+                    iterator() = default;
+
+                    reference operator*() const { return token; }
+
+                    pointer operator->() const { return &token; }
+
+                    iterator& operator++();
+
+                    iterator operator++(int) { iterator previous = *this; ++(*this); return previous; }
+
+                    bool operator==( const iterator& other ) const { return done == other.done && ( done || index == other.index ); }
+
+                    bool operator!=( const iterator& other ) const { return !(*this == other); }
+
+                private:
+
+                    friend class ExplodeRange;
+
+                    explicit iterator( const ExplodeRange* range );
+
+                    void load( std::string::size_type start );
+
+                    const ExplodeRange* range = nullptr;
+
+                    std::size_t index = 0;
+
+                    std::string::size_type finish = 0;
+
+                    std::string_view token;
+
+                    bool done = true;
+
+            };
+
+            ExplodeRange( std::string_view string, std::string_view separator, std::size_t limit = std::numeric_limits<size_t>::max() );
+
+            iterator begin() const { return iterator(this); }
+
+            iterator end() const { return iterator(); }
+
+        private:
+
+            std::string_view text;
+
+            std::string_view separator;
+
+            std::size_t limit;
+
+            std::vector<std::uint32_t> graphemes;
+
+    };
+
+    ExplodeRange explode_view( std::string_view string, std::string_view separator, std::size_t limit = std::numeric_limits<size_t>::max() );
+
     std::string implode( const std::vector<std::string>& array, const std::string& delimeter = "" );
 
     std::string implode( char* array[], int size, const std::string& delimiter = "" );
 
     std::string implode( const char* array[], int size, const std::string& delimiter = "" );
 
+    bool isValidUTF8( std::string_view string );
+
+    std::string::size_type countUTF16( std::string_view string );
+
     std::string::size_type IndexUTF16_toUTF8( const std::string& utf8_string, std::string::size_type utf16_index_alvo );
 
     std::string::size_type IndexUTF8_toUTF16( const std::string& utf8_string, std::string::size_type byte_index_alvo );
 
     std::vector<std::string::size_type> MapIndexUTF8_toUTF16( const std::string& utf8_string );
 
-    std::string::size_type search( const std::string& string, const std::string& search );
+    /**
+     * Conversor incremental de offsets em bytes (UTF-8) para índices UTF-16, para offsets consultados em ordem crescente.
+     *
+     * Guarda a posição da última consulta e a contagem UTF-16 acumulada até ela, de modo que cada consulta só
+     * percorre o trecho desde a anterior. Nada é alocado; a string referenciada deve continuar válida enquanto o cursor for usado.
+     */
+    class UTF16OffsetCursor {
+
+        public:
+
+            explicit UTF16OffsetCursor( std::string_view string ) : text(string) {}
+
+            std::string::size_type toUTF16( std::string::size_type byteOffset );
+
+        private:
+
+            std::string_view text;
+
+            std::string::size_type byte = 0;
+
+            std::string::size_type units = 0;
+
+    };
+
+    std::string::size_type findLiteral( std::string_view string, std::string_view search, std::string::size_type offset = 0 );
+
+    bool isLiteralPattern( const std::string& pattern, std::string* literal = nullptr );
+
+    std::string::size_type search( const std::string& string, const std::string& search, bool literal = false );
+
+    std::vector<std::string::size_type> search_all( const std::string& string, const std::string& search, std::size_t limit = std::numeric_limits<size_t>::max(), bool literal = false );
+
+    /**
+     * Resultado de similarWords(): posição da palavra no dicionário e sua distância de edição até a consulta.
+     */
+    struct DistanceMatch {
+
+        std::size_t index;
+
+        std::size_t distance;
+
+    };
+
+    std::size_t levenshtein( std::string_view first, std::string_view second );
+
+    std::vector<DistanceMatch> similarWords( std::string_view query, const std::vector<std::string>& dictionary, std::size_t maxDistance );
 
-    std::vector<std::string::size_type> search_all( const std::string& string, const std::string& search, std::size_t limit = std::numeric_limits<size_t>::max() );
+    std::vector<std::size_t> collationOrder( const std::vector<std::string>& words );
 
 }
 
@@ -405,13 +405,10 @@ namespace forcaFiles {
             std::string content = forcaFiles::read::getContent(filename);
 
             /* 
-                Porque usei a função de remover espaços? Pois nesse caso, uma string não vazia (string.length() > 0),
-                mas que só apresenta espaços é considerada vazia, portanto, se eu remover todos os espaços a string
-                fica realmente vazia (string.length() == 0) e podemos usar a função string.empty()
+                Um arquivo que só apresenta espaços também é considerado vazio. Em vez de remover todos os espaços
+                (o que criaria uma cópia do conteúdo), basta verificar se o trim do conteúdo, feito sem cópia, fica vazio.
             */
-            content = forcaStrings::removeSpaces(content);
-
-            if(content.empty()) return true;
+            if( forcaStrings::trim_view(content).empty() ) return true;
 
             return false;
 
@@ -21,6 +21,8 @@
 #include <sstream>
 #include <algorithm>
 #include <limits>
+#include <cmath>
+#include <utility>
 #include <nlohmann/json.hpp>
 
 #include <exception>
@@ -421,11 +423,12 @@ NativeFunctionHandler::NativeFunctionHandler() {
             
             try {
 
-                std::string string = args[0]->GetStringValue();
+                // Buffer reaproveitado entre as chamadas: a conversão roda a cada tecla digitada.
+                thread_local std::string buffer;
 
-                string = forcaStrings::to_uppercase(string);
+                forcaStrings::to_uppercase(args[0]->GetStringValue().ToString(), buffer);
 
-                retval = CefV8Value::CreateString(string);
+                retval = CefV8Value::CreateString(buffer);
 
                 return true;
 
@@ -452,11 +455,12 @@ NativeFunctionHandler::NativeFunctionHandler() {
            
             try {
 
-                std::string string = args[0]->GetStringValue();
+                // Buffer reaproveitado entre as chamadas: a conversão roda a cada tecla digitada.
+                thread_local std::string buffer;
 
-                string = forcaStrings::to_lowercase(string);
+                forcaStrings::to_lowercase(args[0]->GetStringValue().ToString(), buffer);
 
-                retval = CefV8Value::CreateString(string);
+                retval = CefV8Value::CreateString(buffer);
 
                 return true;
 
@@ -521,7 +525,7 @@ NativeFunctionHandler::NativeFunctionHandler() {
 
                 }
 
-                std::string normalize = forcaStrings::normalize(string, form);
+                std::string normalize = forcaStrings::normalize(std::move(string), form);
 
                 retval = CefV8Value::CreateString(normalize);
 
@@ -813,7 +817,20 @@ NativeFunctionHandler::NativeFunctionHandler() {
 
                 std::string string = args[0]->GetStringValue();
 
-                bool isAlpha = forcaStrings::checkAlphaCharacters(string);
+                forcaStrings::AlphaScript script = forcaStrings::AlphaScript::ASCII;
+
+                if( args.size() > 1 && ! args[1]->IsUndefined() ){
+
+                    if( ! args[1]->IsString() ){
+                        exception = "O parâmetro script deve ser uma string!";
+                        return true;
+                    }
+
+                    script = forcaStrings::alphaScriptFromName( args[1]->GetStringValue() );
+
+                }
+
+                bool isAlpha = forcaStrings::checkAlphaCharacters(string, script);
 
                 retval = CefV8Value::CreateBool(isAlpha);
 
@@ -837,6 +854,85 @@ NativeFunctionHandler::NativeFunctionHandler() {
 
     );
 
+    router_->RegisterFunction("checkAlphaCharactersArray",
+        [](const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& exception) -> bool {
+            
+            try {
+
+                if(args.size() < 1){
+                    exception = "Quantidade insuficiente de parâmetros fornecidos para a função.";
+                    return true;
+                }
+
+                if( ! args[0]->IsArray() ){
+                    exception = "O array deve ser um array de strings!";
+                    return true;
+                }
+
+                forcaStrings::AlphaScript script = forcaStrings::AlphaScript::ASCII;
+
+                if( args.size() > 1 && ! args[1]->IsUndefined() ){
+
+                    if( ! args[1]->IsString() ){
+                        exception = "O parâmetro script deve ser uma string!";
+                        return true;
+                    }
+
+                    script = forcaStrings::alphaScriptFromName( args[1]->GetStringValue() );
+
+                }
+
+                CefRefPtr<CefV8Value> wordsArray = args[0];
+
+                std::size_t i, wordsSize = wordsArray->GetArrayLength();
+
+                std::vector<std::string> words;
+
+                words.reserve(wordsSize);
+
+                for(i=0; i<wordsSize; i++){
+
+                    CefRefPtr<CefV8Value> word = wordsArray->GetValue(i);
+
+                    if( ! word->IsString() ){
+                        exception = "O array deve ser um array de strings!";
+                        return true;
+                    }
+
+                    words.push_back( word->GetStringValue() );
+
+                }
+
+                std::vector<bool> result = forcaStrings::checkAlphaCharacters(words, script);
+
+                CefRefPtr<CefV8Value> array = CefV8Value::CreateArray(wordsSize);
+
+                for(i=0; i<wordsSize; i++){
+                    array->SetValue(i, CefV8Value::CreateBool( result[i] ));
+                }
+
+                retval = array;
+
+                return true;
+
+            } catch (const std::exception& e) {
+
+                exception = ForcaInterface::exceptionText(e);
+
+                return true;
+
+            } catch (...) {
+
+                exception = "Erro ao executar função no backend! \n\nTipo de exceção: Desconhecido \n\nMensagem: Exceção desconhecida!\n";
+
+                return true;
+
+            }    
+
+        }
+
+    );
+
     router_->RegisterFunction("concat",
         [](const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& exception) -> bool {
             
@@ -960,7 +1056,10 @@ NativeFunctionHandler::NativeFunctionHandler() {
 
                 std::string find = args[1]->GetStringValue();
 
-                std::string::size_type pos = forcaStrings::firstIndexOf(string, find);
+                // Strings grandes não passam pelo cache: a busca direta para assim que encontra o resultado.
+                const forcaStrings::GraphemeIndex* graphemes = forcaStrings::GraphemeIndex::cached(string);
+
+                std::string::size_type pos = ( graphemes != nullptr ) ? graphemes->firstIndexOf(find) : forcaStrings::firstIndexOf(string, find);
 
                 CefRefPtr<CefV8Value> index;
 
@@ -1013,7 +1112,10 @@ NativeFunctionHandler::NativeFunctionHandler() {
 
                 std::string find = args[1]->GetStringValue();
 
-                std::string::size_type pos = forcaStrings::lastIndexOf(string, find);
+                // Strings grandes não passam pelo cache: a busca direta para assim que encontra o resultado.
+                const forcaStrings::GraphemeIndex* graphemes = forcaStrings::GraphemeIndex::cached(string);
+
+                std::string::size_type pos = ( graphemes != nullptr ) ? graphemes->lastIndexOf(find) : forcaStrings::lastIndexOf(string, find);
 
                 CefRefPtr<CefV8Value> index;
 
@@ -1175,7 +1277,13 @@ NativeFunctionHandler::NativeFunctionHandler() {
                     return true;
                 }
 
-                std::size_t length = forcaStrings::VisibleLength(string);
+                const forcaStrings::GraphemeIndex* index = forcaStrings::GraphemeIndex::cached(string);
+
+                /*
+                    Strings grandes não passam pelo cache: o grapheme é buscado direto, parando na posição pedida,
+                    e um índice além do fim é detectado pela exceção de forcaStrings::charAt().
+                */
+                std::size_t length = ( index != nullptr ) ? index->length() : std::numeric_limits<std::size_t>::max();
 
                 std::string::size_type charAt;
 
@@ -1202,7 +1310,20 @@ NativeFunctionHandler::NativeFunctionHandler() {
                     charAt = 0;
                 }
 
-                std::string charString = forcaStrings::charAt(string, charAt);
+                std::string charString;
+
+                if( index != nullptr ){
+                    charString = index->charAt(charAt);
+                }
+                else{
+
+                    try {
+                        charString = forcaStrings::charAt(string, charAt);
+                    } catch (const std::out_of_range&) {
+                        charString = "";
+                    }
+
+                }
 
                 retval = CefV8Value::CreateString(charString);
 
@@ -1305,7 +1426,11 @@ NativeFunctionHandler::NativeFunctionHandler() {
 
                 std::string string = args[0]->GetStringValue();
 
-                std::string::size_type stringLength = forcaStrings::VisibleLength(string);
+                forcaStrings::GraphemeIndex local;
+
+                const forcaStrings::GraphemeIndex& index = forcaStrings::GraphemeIndex::cached(string, local);
+
+                std::string::size_type stringLength = index.length();
 
                 double startValue = args[1]->GetDoubleValue();
 
@@ -1356,7 +1481,7 @@ NativeFunctionHandler::NativeFunctionHandler() {
 
                 }
                 
-                std::string substring = forcaStrings::substring( string, startValue, (endValue - startValue) );
+                std::string substring( index.slice( startValue, (endValue - startValue) ) );
 
                 retval = CefV8Value::CreateString(substring);
 
@@ -1398,7 +1523,11 @@ NativeFunctionHandler::NativeFunctionHandler() {
 
                 std::string string = args[0]->GetStringValue();
 
-                std::string::size_type stringLength = forcaStrings::VisibleLength(string);
+                forcaStrings::GraphemeIndex local;
+
+                const forcaStrings::GraphemeIndex& index = forcaStrings::GraphemeIndex::cached(string, local);
+
+                std::string::size_type stringLength = index.length();
 
                 double startValue = args[1]->GetDoubleValue();
 
@@ -1438,7 +1567,7 @@ NativeFunctionHandler::NativeFunctionHandler() {
 
                 }
 
-                std::string substring = forcaStrings::substring( string, startValue, (endValue - startValue) );
+                std::string substring( index.slice( startValue, (endValue - startValue) ) );
 
                 retval = CefV8Value::CreateString(substring);
 
@@ -1573,22 +1702,38 @@ NativeFunctionHandler::NativeFunctionHandler() {
 
                 }
                 
-                std::vector<std::string> explode;
+                /*
+                    Os pedaços são views sobre a string original, então cada um só é copiado uma vez,
+                    direto para a string JS. O separador literal é percorrido de forma preguiçosa pelo ExplodeRange.
+                */
+                CefRefPtr<CefV8Value> array;
 
                 if(isRegex){
-                    explode = forcaRegex::preg_split(searchValue, string, limit);
+
+                    std::vector<std::string_view> explode = forcaRegex::preg_split_view(searchValue, string, limit);
+
+                    std::size_t i, explodeSize = explode.size();
+
+                    array = CefV8Value::CreateArray(explodeSize);
+
+                    for(i=0; i<explodeSize; i++){
+
+                        array->SetValue(i, CefV8Value::CreateString( std::string(explode[i]) ));
+
+                    }
+
                 }
                 else{
-                    forcaStrings::explode(string, searchValue, &explode, limit);
-                }
 
-                std::size_t i, explodeSize = explode.size();
+                    array = CefV8Value::CreateArray(0);
 
-                CefRefPtr<CefV8Value> array = CefV8Value::CreateArray(explodeSize);
+                    int i = 0;
 
-                for(i=0; i<explodeSize; i++){
+                    for( std::string_view token : forcaStrings::explode_view(string, searchValue, limit) ){
 
-                    array->SetValue(i, CefV8Value::CreateString(explode[i]));
+                        array->SetValue(i++, CefV8Value::CreateString( std::string(token) ));
+
+                    }
 
                 }
 
@@ -1841,7 +1986,7 @@ NativeFunctionHandler::NativeFunctionHandler() {
                 }
                 else{   // Faz a substituição baseado em string
 
-                    std::string::size_type searchPos = string.find(searchValue, offset);
+                    std::string::size_type searchPos = forcaStrings::findLiteral(string, searchValue, offset);
 
                     if(searchPos != std::string::npos){
 
@@ -2055,24 +2200,85 @@ NativeFunctionHandler::NativeFunctionHandler() {
                 }
                 else{   // Faz a substituição baseado em string
 
-                    std::string::size_type searchPos = string.find(searchValue, offset);
+                    /*
+                        Como no replaceAll do JS, um texto vazio ocorre em todas as posições entre os caracteres, incluindo
+                        o início e o fim: "abc".replaceAll("", "-") resulta em "-a-b-c-". As posições seguem os code points,
+                        sem dividir sequências UTF-8, e o str_replace (que usa a mesma busca) insere no offset.
+                    */
+                    if(searchValue.empty()){
+
+                        std::string output;
+
+                        output.reserve( string.length() + replaceValue.length() );
+
+                        output.append(string, 0, offset);
+
+                        std::string::size_type pos = offset, length = string.length();
+
+                        std::size_t count = 0;
+
+                        while(count < limit){
+
+                            output += replaceValue;
+
+                            count++;
+
+                            if(pos >= length) break;
+
+                            // Avança um code point: o byte inicial e os bytes de continuação (10xxxxxx).
+                            std::string::size_type next = pos + 1;
+
+                            while( next < length && ( static_cast<unsigned char>(string[next]) & 0xC0 ) == 0x80 ) next++;
+
+                            output.append(string, pos, next - pos);
+
+                            pos = next;
+
+                        }
+
+                        output.append(string, pos, std::string::npos);
+
+                        retval = CefV8Value::CreateString(output);
+
+                        return true;
+
+                    }
+
+                    std::string::size_type searchPos = forcaStrings::findLiteral(string, searchValue, offset);
+
+                    std::string::size_type searchLenght = searchValue.length();
+
+                    std::string::size_type lastPos = 0;
 
                     std::size_t count = 0;
 
-                    std::string::size_type replaceLength = replaceValue.length();
+                    // Monta a saída em uma única passada, sem os replace() no meio da string.
+                    std::string output;
+
+                    output.reserve( string.length() );
 
                     while(searchPos != std::string::npos && count < limit){
 
-                        std::string::size_type searchLenght = searchValue.length();
+                        output.append(string, lastPos, searchPos - lastPos);
 
-                        string.replace(searchPos, searchLenght, replaceValue);
+                        output += replaceValue;
+
+                        lastPos = searchPos + searchLenght;
 
-                        searchPos = string.find( searchValue, (searchPos + replaceLength) );
+                        searchPos = forcaStrings::findLiteral( string, searchValue, lastPos );
 
                         count++;
 
                     }
 
+                    if(count > 0){
+
+                        output.append(string, lastPos, std::string::npos);
+
+                        string.swap(output);
+
+                    }
+
                     retval = CefV8Value::CreateString(string);
 
                     return true;
@@ -2416,6 +2622,155 @@ NativeFunctionHandler::NativeFunctionHandler() {
         }
     );        
 
+    router_->RegisterFunction("regexSetMatch",
+        [=](const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& exception) -> bool {
+
+            try {
+
+                std::size_t argsSize = args.size();
+
+                if(argsSize < 2){
+                    exception = "Quantidade insuficiente de parâmetros fornecidos para a função.";
+                    return true;
+                }
+
+                CefRefPtr<CefV8Value> subjects = args[0];
+
+                if( ! subjects->IsString() && ! subjects->IsArray() ){
+                    exception = "O parâmetro subject deve ser do tipo string ou um array de strings!";
+                    return true;
+                }
+
+                if( ! args[1]->IsArray() ){
+                    exception = "O primeiro parâmetro patterns deve ser um array de strings ou expressões regulares!";
+                    return true;
+                }
+
+                CefRefPtr<CefV8Value> patternsArray = args[1];
+
+                std::size_t i, patternsSize = patternsArray->GetArrayLength();
+
+                std::vector<std::string> patterns;
+
+                patterns.reserve(patternsSize);
+
+                /* 
+                    Cada padrão pode ser uma string no formato /pattern/flags ou um RegExp do JS, que é
+                    convertido para string com a função nativa String(), igual às outras funções de regex.
+                */
+                for(i=0; i<patternsSize; i++){
+
+                    CefRefPtr<CefV8Value> pattern = patternsArray->GetValue(i);
+
+                    if( pattern->IsString() ){
+
+                        patterns.push_back( forcaStrings::trim( pattern->GetStringValue() ) );
+
+                    }
+                    else if( pattern->IsObject() && jsStringObj && jsStringObj->IsFunction() ){
+
+                        CefV8ValueList argsString;
+                        argsString.push_back(pattern);
+
+                        // Executa String(value)
+                        CefRefPtr<CefV8Value> result = jsStringObj->ExecuteFunction(nullptr, argsString);
+
+                        if( ! result || ! result->IsString() ){
+                            exception = "O primeiro parâmetro patterns deve ser um array de strings ou expressões regulares!";
+                            return true;
+                        }
+
+                        patterns.push_back( result->GetStringValue().ToString() );
+
+                    }
+                    else{
+                        exception = "O primeiro parâmetro patterns deve ser um array de strings ou expressões regulares!";
+                        return true;
+                    }
+
+                }
+
+                // O conjunto é compilado uma única vez e usado para todos os subjects.
+                forcaRegex::RegexSet set(patterns);
+
+                // Converte o resultado de um subject em um array JS, com os índices em UTF-16.
+                auto createResult = [&set]( const std::string& subject ) -> CefRefPtr<CefV8Value> {
+
+                    std::vector<forcaRegex::RegexSetMatch> matches = set.match(subject);
+
+                    std::size_t j, matchesSize = matches.size();
+
+                    CefRefPtr<CefV8Value> array = CefV8Value::CreateArray(matchesSize);
+
+                    for(j=0; j<matchesSize; j++){
+
+                        CefRefPtr<CefV8Value> object = CefV8Value::CreateObject(nullptr, nullptr);
+
+                        object->SetValue("match", CefV8Value::CreateBool(matches[j].match), V8_PROPERTY_ATTRIBUTE_NONE);
+
+                        if(matches[j].match){
+                            object->SetValue("start", CefV8Value::CreateDouble( forcaStrings::IndexUTF8_toUTF16(subject, matches[j].start) ), V8_PROPERTY_ATTRIBUTE_NONE);
+                            object->SetValue("end", CefV8Value::CreateDouble( forcaStrings::IndexUTF8_toUTF16(subject, matches[j].end) ), V8_PROPERTY_ATTRIBUTE_NONE);
+                        }
+                        else{
+                            object->SetValue("start", CefV8Value::CreateDouble(-1), V8_PROPERTY_ATTRIBUTE_NONE);
+                            object->SetValue("end", CefV8Value::CreateDouble(-1), V8_PROPERTY_ATTRIBUTE_NONE);
+                        }
+
+                        array->SetValue(j, object);
+
+                    }
+
+                    return array;
+
+                };
+
+                if( subjects->IsString() ){
+
+                    retval = createResult( subjects->GetStringValue() );
+
+                    return true;
+
+                }
+
+                std::size_t subjectsSize = subjects->GetArrayLength();
+
+                CefRefPtr<CefV8Value> array = CefV8Value::CreateArray(subjectsSize);
+
+                for(i=0; i<subjectsSize; i++){
+
+                    CefRefPtr<CefV8Value> subject = subjects->GetValue(i);
+
+                    if( ! subject->IsString() ){
+                        exception = "O parâmetro subject deve ser do tipo string ou um array de strings!";
+                        return true;
+                    }
+
+                    array->SetValue( i, createResult( subject->GetStringValue() ) );
+
+                }
+
+                retval = array;
+
+                return true;
+
+            } catch (const std::exception& e) {
+
+                exception = ForcaInterface::exceptionText(e);
+
+                return true;
+
+            } catch (...) {
+
+                exception = "Erro ao executar função no backend! \n\nTipo de exceção: Desconhecido \n\nMensagem: Exceção desconhecida!\n";
+
+                return true;
+
+            }
+
+        }
+    );
+
     router_->RegisterFunction("search",
         [=](const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& exception) -> bool {
 
@@ -2537,6 +2892,8 @@ NativeFunctionHandler::NativeFunctionHandler() {
 
                 std::string searchValue;
 
+                bool isLiteral = false;
+
                 if( ! search->IsObject() && ! search->IsString() ){
                     exception = "O primeiro parâmetro search deve ser do tipo string ou uma expressão regular!";
                     return true;
@@ -2562,7 +2919,12 @@ NativeFunctionHandler::NativeFunctionHandler() {
                     
                 }
                 else if( search->IsString() ){
-                    searchValue = "/" + search->GetStringValue().ToString() + "/";
+
+                    // Strings são buscadas como texto literal (metacaracteres não têm efeito), sem passar pelo PCRE2.
+                    searchValue = search->GetStringValue().ToString();
+
+                    isLiteral = true;
+
                 }
                 else{
                     exception = "O primeiro parâmetro search deve ser do tipo string ou uma expressão regular!";
@@ -2571,22 +2933,26 @@ NativeFunctionHandler::NativeFunctionHandler() {
                 
                 std::string::size_type resultLength = searchValue.length();
 
-                if(resultLength < 3){
-                    exception = "Expressão regular mal formada no primeiro parâmetro search!";
-                    return true;
-                }
+                if( ! isLiteral ){
 
-                if(searchValue[0] != '/' && searchValue[0] != '#'){
-                    exception = "Expressão regular mal formada no primeiro parâmetro search!";
-                    return true;
-                }
+                    if(resultLength < 3){
+                        exception = "Expressão regular mal formada no primeiro parâmetro search!";
+                        return true;
+                    }
 
-                std::string::size_type pos = searchValue.find_last_of(searchValue[0]);
+                    if(searchValue[0] != '/' && searchValue[0] != '#'){
+                        exception = "Expressão regular mal formada no primeiro parâmetro search!";
+                        return true;
+                    }
 
-                if( pos != std::string::npos && pos < 2 ){
-                    exception = "Expressão regular mal formada no primeiro parâmetro search!";
-                    return true;
-                }      
+                    std::string::size_type pos = searchValue.find_last_of(searchValue[0]);
+
+                    if( pos != std::string::npos && pos < 2 ){
+                        exception = "Expressão regular mal formada no primeiro parâmetro search!";
+                        return true;
+                    }
+
+                }
                 
                 std::size_t limit = std::numeric_limits<size_t>::max();
 
@@ -2629,7 +2995,7 @@ NativeFunctionHandler::NativeFunctionHandler() {
 
                 }
 
-                std::vector<std::string::size_type> all_index = forcaStrings::search_all(string, searchValue, limit);
+                std::vector<std::string::size_type> all_index = forcaStrings::search_all(string, searchValue, limit, isLiteral);
 
                 if(all_index.empty()){
 
@@ -2670,6 +3036,183 @@ NativeFunctionHandler::NativeFunctionHandler() {
         }
     );    
 
+    router_->RegisterFunction("similarWords",
+        [=](const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& exception) -> bool {
+
+            try {
+
+                std::size_t argsSize = args.size();
+
+                if(argsSize < 2){
+                    exception = "Quantidade insuficiente de parâmetros fornecidos para a função.";
+                    return true;
+                }
+
+                if( ! args[1]->IsArray() ){
+                    exception = "O primeiro parâmetro dictionary deve ser um array de strings!";
+                    return true;
+                }
+
+                std::string query = args[0]->GetStringValue();
+
+                double maxDistanceValue = 2;
+
+                if( argsSize > 2 && ! args[2]->IsUndefined() ){
+
+                    if( ! args[2]->IsInt() && ! args[2]->IsDouble() && ! args[2]->IsUInt() ){
+                        exception = "O segundo parâmetro maxDistance deve ser do tipo inteiro e positivo!";
+                        return true;
+                    }
+
+                    maxDistanceValue = args[2]->GetDoubleValue();
+
+                    // NaN e Infinity também são números no JS, mas não são uma distância válida.
+                    if( ! std::isfinite(maxDistanceValue) || maxDistanceValue < 0 ){
+                        exception = "O segundo parâmetro maxDistance deve ser do tipo inteiro e positivo!";
+                        return true;
+                    }
+
+                }
+
+                CefRefPtr<CefV8Value> dictionaryArray = args[1];
+
+                std::size_t i, dictionarySize = dictionaryArray->GetArrayLength();
+
+                std::vector<std::string> dictionary;
+
+                dictionary.reserve(dictionarySize);
+
+                for(i=0; i<dictionarySize; i++){
+
+                    CefRefPtr<CefV8Value> word = dictionaryArray->GetValue(i);
+
+                    if( ! word->IsString() ){
+                        exception = "O primeiro parâmetro dictionary deve ser um array de strings!";
+                        return true;
+                    }
+
+                    dictionary.push_back( word->GetStringValue() );
+
+                }
+
+                /*
+                    A distância nunca passa do tamanho da consulta mais o da maior palavra, então valores maiores
+                    são limitados a isso antes da conversão para inteiro (que seria indefinida para valores enormes).
+                */
+                std::size_t longestWord = 0;
+
+                for(const std::string& word : dictionary) longestWord = std::max( longestWord, word.length() );
+
+                std::size_t distanceBound = query.length() + longestWord;
+
+                std::size_t maxDistance = ( maxDistanceValue >= static_cast<double>(distanceBound) ) ? distanceBound : static_cast<std::size_t>(maxDistanceValue);
+
+                std::vector<forcaStrings::DistanceMatch> matches = forcaStrings::similarWords(query, dictionary, maxDistance);
+
+                std::size_t matchesSize = matches.size();
+
+                CefRefPtr<CefV8Value> array = CefV8Value::CreateArray(matchesSize);
+
+                for(i=0; i<matchesSize; i++){
+
+                    CefRefPtr<CefV8Value> object = CefV8Value::CreateObject(nullptr, nullptr);
+
+                    object->SetValue("word", CefV8Value::CreateString( dictionary[ matches[i].index ] ), V8_PROPERTY_ATTRIBUTE_NONE);
+
+                    object->SetValue("index", CefV8Value::CreateDouble( matches[i].index ), V8_PROPERTY_ATTRIBUTE_NONE);
+
+                    object->SetValue("distance", CefV8Value::CreateDouble( matches[i].distance ), V8_PROPERTY_ATTRIBUTE_NONE);
+
+                    array->SetValue(i, object);
+
+                }
+
+                retval = array;
+
+                return true;
+
+            } catch (const std::exception& e) {
+
+                exception = ForcaInterface::exceptionText(e);
+
+                return true;
+
+            } catch (...) {
+
+                exception = "Erro ao executar função no backend! \n\nTipo de exceção: Desconhecido \n\nMensagem: Exceção desconhecida!\n";
+
+                return true;
+
+            }
+
+        }
+    );
+
+    router_->RegisterFunction("collationOrder",
+        [=](const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& exception) -> bool {
+
+            try {
+
+                if(args.size() < 1){
+                    exception = "Quantidade insuficiente de parâmetros fornecidos para a função.";
+                    return true;
+                }
+
+                if( ! args[0]->IsArray() ){
+                    exception = "O array deve ser um array de strings!";
+                    return true;
+                }
+
+                CefRefPtr<CefV8Value> wordsArray = args[0];
+
+                std::size_t i, wordsSize = wordsArray->GetArrayLength();
+
+                std::vector<std::string> words;
+
+                words.reserve(wordsSize);
+
+                for(i=0; i<wordsSize; i++){
+
+                    CefRefPtr<CefV8Value> word = wordsArray->GetValue(i);
+
+                    if( ! word->IsString() ){
+                        exception = "O array deve ser um array de strings!";
+                        return true;
+                    }
+
+                    words.push_back( word->GetStringValue() );
+
+                }
+
+                std::vector<std::size_t> order = forcaStrings::collationOrder(words);
+
+                CefRefPtr<CefV8Value> array = CefV8Value::CreateArray(wordsSize);
+
+                for(i=0; i<wordsSize; i++){
+                    array->SetValue(i, CefV8Value::CreateDouble( order[i] ));
+                }
+
+                retval = array;
+
+                return true;
+
+            } catch (const std::exception& e) {
+
+                exception = ForcaInterface::exceptionText(e);
+
+                return true;
+
+            } catch (...) {
+
+                exception = "Erro ao executar função no backend! \n\nTipo de exceção: Desconhecido \n\nMensagem: Exceção desconhecida!\n";
+
+                return true;
+
+            }
+
+        }
+    );
+
     router_->RegisterFunction("VisibleLength",
         [=](const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& exception) -> bool {
 
@@ -2677,7 +3220,10 @@ NativeFunctionHandler::NativeFunctionHandler() {
 
                 std::string string = args[0]->GetStringValue();
 
-                retval = CefV8Value::CreateDouble( forcaStrings::VisibleLength(string) );
+                // Strings grandes são só contadas, sem guardar as fronteiras.
+                const forcaStrings::GraphemeIndex* index = forcaStrings::GraphemeIndex::cached(string);
+
+                retval = CefV8Value::CreateDouble( ( index != nullptr ) ? index->length() : forcaStrings::VisibleLength(string) );
 
                 return true;
 
@@ -3265,6 +3811,8 @@ void ForcaCefApp::OnContextCreated(CefRefPtr<CefBrowser> browser, CefRefPtr<CefF
 
     ForcaAppObj->SetValue("checkAlphaCharacters", CefV8Value::CreateFunction("checkAlphaCharacters", nativeSyncHandler), V8_PROPERTY_ATTRIBUTE_NONE);
 
+    ForcaAppObj->SetValue("checkAlphaCharactersArray", CefV8Value::CreateFunction("checkAlphaCharactersArray", nativeSyncHandler), V8_PROPERTY_ATTRIBUTE_NONE);
+
     ForcaAppObj->SetValue("includes", CefV8Value::CreateFunction("includes", nativeSyncHandler), V8_PROPERTY_ATTRIBUTE_NONE);
 
     ForcaAppObj->SetValue("indexOf", CefV8Value::CreateFunction("indexOf", nativeSyncHandler), V8_PROPERTY_ATTRIBUTE_NONE);
@@ -3297,12 +3845,18 @@ void ForcaCefApp::OnContextCreated(CefRefPtr<CefBrowser> browser, CefRefPtr<CefF
 
     ForcaAppObj->SetValue("preg_split", CefV8Value::CreateFunction("preg_split", nativeSyncHandler), V8_PROPERTY_ATTRIBUTE_NONE);
 
+    ForcaAppObj->SetValue("regexSetMatch", CefV8Value::CreateFunction("regexSetMatch", nativeSyncHandler), V8_PROPERTY_ATTRIBUTE_NONE);
+
     ForcaAppObj->SetValue("search", CefV8Value::CreateFunction("search", nativeSyncHandler), V8_PROPERTY_ATTRIBUTE_NONE);
 
     ForcaAppObj->SetValue("searchAll", CefV8Value::CreateFunction("searchAll", nativeSyncHandler), V8_PROPERTY_ATTRIBUTE_NONE);
 
     ForcaAppObj->SetValue("VisibleLength", CefV8Value::CreateFunction("VisibleLength", nativeSyncHandler), V8_PROPERTY_ATTRIBUTE_NONE);
 
+    ForcaAppObj->SetValue("similarWords", CefV8Value::CreateFunction("similarWords", nativeSyncHandler), V8_PROPERTY_ATTRIBUTE_NONE);
+
+    ForcaAppObj->SetValue("collationOrder", CefV8Value::CreateFunction("collationOrder", nativeSyncHandler), V8_PROPERTY_ATTRIBUTE_NONE);
+
     ForcaAppObj->SetValue("filterValidateBoolean", CefV8Value::CreateFunction("filterValidateBoolean", nativeSyncHandler), V8_PROPERTY_ATTRIBUTE_NONE);
 
     ForcaAppObj->SetValue("getStringContent", CefV8Value::CreateFunction("getStringContent", nativeSyncHandler), V8_PROPERTY_ATTRIBUTE_NONE);
@@ -2,12 +2,20 @@
 #define PCRE2_CODE_UNIT_WIDTH 8
 #include <pcre2.h>
 #include <cstring>
+#include <cctype>
 #include <string>
 #include <stdexcept>
 #include <map>
 #include <vector>
+#include <list>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
 #include <memory> // Para gerenciamento de memória com unique_ptr
 #include "forcaRegex.h"
+#ifndef FORCA_REGEX_NO_BUNDLE
+    #include "forcaRegexBuiltins.h"
+#endif
 
 /**
  * Namespace que implementa funcionalidades de expressões regulares inspiradas no PHP.
@@ -20,6 +28,8 @@
  * - Suporta as mesmas flags de modificadores (i, m, s, u, x, U)
  * - Mantém compatibilidade com padrões regex do PHP
  * - Otimizado para operações em strings grandes
+ * - Padrões compilados ficam em um cache LRU, cada padrão é compilado uma única vez
+ * - Usa o JIT do PCRE2 quando disponível, com fallback automático para o interpretador
  * - Usa PCRE2 como motor regex (mesmo do PHP)
  * * @namespace   forcaRegex
  * @see         https://www.php.net/manual/pt_BR/book.pcre.php
@@ -27,22 +37,14 @@
 namespace forcaRegex {
 
     /**
-     * Cria e compila um padrão de expressão regular no estilo PHP.
-     * Aceita delimitadores '/' ou '#' e suporta as flags: i, m, s, u, x, U.
-     * * Exemplo de padrão: "/regex/im" ou "#regex#u"
-     * * Flags suportadas:
-     * i - PCRE2_CASELESS  - Case insensitive
-     * m - PCRE2_MULTILINE - Multiline mode
-     * s - PCRE2_DOTALL    - Dot matches all
-     * u - PCRE2_UTF       - UTF-8 mode
-     * x - PCRE2_EXTENDED  - Extended mode
-     * U - PCRE2_UNGREEDY  - Ungreedy mode
-     * * @param   const std::string& pattern    String contendo o padrão regex no formato /pattern/flags
-     * @return  RegexPattern                  Estrutura contendo o padrão compilado e suas configurações
+     * Faz o parse de um padrão no estilo PHP (/regex/flags ou #regex#flags), preenchendo
+     * a expressão e as flags de compilação do RegexPattern.
+     * 
+     * @param   const std::string& pattern    String contendo o padrão regex no formato /pattern/flags
+     * @param   RegexPattern& finalPattern    Estrutura que recebe a expressão e as flags
      * @throws  std::invalid_argument         Se o padrão regex estiver malformado
-     * @throws  std::runtime_error           Se houver erro na compilação do padrão
      */
-    std::unique_ptr<forcaRegex::RegexPattern> createPattern( const std::string& pattern ) {
+    static void parsePattern( const std::string& pattern, forcaRegex::RegexPattern& finalPattern ) {
 
         std::string cpypattern = pattern;
 
@@ -143,33 +145,93 @@ namespace forcaRegex {
 
         }
 
-        std::unique_ptr<forcaRegex::RegexPattern> finalPattern = std::make_unique<forcaRegex::RegexPattern>();
+        finalPattern.expression = expression;
+        finalPattern.pattern = reinterpret_cast<PCRE2_SPTR>( finalPattern.expression.c_str() );
+        finalPattern.length = static_cast<PCRE2_SIZE>( expressionLength );
+        finalPattern.options = options;
 
-        finalPattern->expression = expression;
-        finalPattern->pattern = reinterpret_cast<PCRE2_SPTR>( finalPattern->expression.c_str() );
-        finalPattern->length = static_cast<PCRE2_SIZE>( expressionLength );
-        finalPattern->options = options;
+    }
 
-        finalPattern->compiled.code = pcre2_compile( finalPattern->pattern, finalPattern->length, finalPattern->options, 
-                                                    &finalPattern->compiled.error_code, &finalPattern->compiled.error_offset, 
-                                                    finalPattern->compiled.context );
+    /**
+     * Lê as informações do código compilado (grupos de captura e grupos nomeados)
+     * e compila o padrão pelo JIT, se disponível.
+     * 
+     * @param   RegexPattern& finalPattern    Padrão com o código já compilado
+     */
+    static void loadPatternInfo( forcaRegex::RegexPattern& finalPattern ) {
 
-        
-        if( finalPattern->compiled.code == nullptr ){
+        pcre2_pattern_info( finalPattern.compiled.code, PCRE2_INFO_CAPTURECOUNT, &finalPattern.compiled.captures );
+
+        // Monta a tabela nome -> número dos grupos nomeados uma única vez, assim as buscas não
+        // precisam percorrer a name table do PCRE2 a cada match.
+        uint32_t namecount = 0;
+
+        pcre2_pattern_info( finalPattern.compiled.code, PCRE2_INFO_NAMECOUNT, &namecount );
+
+        if( namecount > 0 ){
+
+            PCRE2_SPTR name_table;
+            uint32_t name_entry_size;
+
+            pcre2_pattern_info( finalPattern.compiled.code, PCRE2_INFO_NAMETABLE, &name_table );
+            pcre2_pattern_info( finalPattern.compiled.code, PCRE2_INFO_NAMEENTRYSIZE, &name_entry_size );
+
+            finalPattern.names.reserve(namecount);
+
+            PCRE2_SPTR entry = name_table;
+
+            for( uint32_t i = 0; i < namecount; i++ ){
+
+                uint32_t group_number = (entry[0] << 8) | entry[1];
+
+                finalPattern.names.emplace_back( std::string( reinterpret_cast<const char*>(entry + 2) ), group_number );
+
+                entry += name_entry_size;
+
+            }
+
+            // A name table do PCRE2 já vem ordenada por nome, mas garante para a busca binária.
+            std::sort( finalPattern.names.begin(), finalPattern.names.end() );
+
+        }
+
+        // Compila também para código de máquina, se o JIT estiver disponível e habilitado.
+        // Se falhar (ex: padrão não suportado pelo JIT) o padrão continua usando o interpretador.
+        if( forcaRegex::isJITEnabled() ){
+
+            finalPattern.compiled.jit = pcre2_jit_compile( finalPattern.compiled.code, PCRE2_JIT_COMPLETE ) == 0;
+
+        }
+
+    }
+
+    /**
+     * Compila a expressão do RegexPattern com o pcre2_compile.
+     * 
+     * @param   RegexPattern& finalPattern    Padrão com a expressão e as flags já preenchidas
+     * @throws  std::runtime_error            Se houver erro na compilação do padrão
+     */
+    static void compileExpression( forcaRegex::RegexPattern& finalPattern ) {
+
+        finalPattern.compiled.code = pcre2_compile( finalPattern.pattern, finalPattern.length, finalPattern.options, 
+                                                    &finalPattern.compiled.error_code, &finalPattern.compiled.error_offset, 
+                                                    finalPattern.compiled.context );
+
+        if( finalPattern.compiled.code == nullptr ){
 
             PCRE2_UCHAR buffer[256];
 
-            int result = pcre2_get_error_message(finalPattern->compiled.error_code, buffer, sizeof(buffer));
+            int result = pcre2_get_error_message(finalPattern.compiled.error_code, buffer, sizeof(buffer));
 
             std::string message;
 
             if (result < 0) {
-                message = "Erro desconhecido ao compilar regex. Código: " + std::to_string(finalPattern->compiled.error_code);
+                message = "Erro desconhecido ao compilar regex. Código: " + std::to_string(finalPattern.compiled.error_code);
             } else {
                 message = "Erro ao compilar regex: ";
                 message += reinterpret_cast<char*>(buffer);
                 message += " (na posição ";
-                message += std::to_string(finalPattern->compiled.error_offset);
+                message += std::to_string(finalPattern.compiled.error_offset);
                 message += ")";
             }
 
@@ -177,422 +239,1653 @@ namespace forcaRegex {
 
         }
 
-        return finalPattern;
-
     }
 
     /**
-     * Executa uma busca por um padrão em uma string (primeira ocorrência).
-     * Similar à função preg_match() do PHP.
-     * * @param   const std::string& pattern    Padrão regex no formato /pattern/flags
-     * @param   const std::string& subject    String onde será feita a busca
-     * @param   PCRE2_SIZE offset            Posição onde iniciar a busca (default: 0)
-     * @return  RegexResult                   Estrutura contendo os resultados da busca
-     * - match: true se encontrou match, false caso contrário
-     * - Grupos numéricos e nomeados acessíveis via get()
+     * Cria e compila um padrão de expressão regular no estilo PHP.
+     * Aceita delimitadores '/' ou '#' e suporta as flags: i, m, s, u, x, U.
+     * * Exemplo de padrão: "/regex/im" ou "#regex#u"
+     * * Flags suportadas:
+     * i - PCRE2_CASELESS  - Case insensitive
+     * m - PCRE2_MULTILINE - Multiline mode
+     * s - PCRE2_DOTALL    - Dot matches all
+     * u - PCRE2_UTF       - UTF-8 mode
+     * x - PCRE2_EXTENDED  - Extended mode
+     * U - PCRE2_UNGREEDY  - Ungreedy mode
+     * * @param   const std::string& pattern    String contendo o padrão regex no formato /pattern/flags
+     * @return  RegexPattern                  Estrutura contendo o padrão compilado e suas configurações
      * @throws  std::invalid_argument         Se o padrão regex estiver malformado
      * @throws  std::runtime_error           Se houver erro na compilação do padrão
      */
-    forcaRegex::RegexResult preg_match( const std::string& pattern, const std::string& subject, PCRE2_SIZE offset ) {
+    std::unique_ptr<forcaRegex::RegexPattern> createPattern( const std::string& pattern ) {
 
-        forcaRegex::RegexResult finalResult;
+        std::unique_ptr<forcaRegex::RegexPattern> finalPattern = std::make_unique<forcaRegex::RegexPattern>();
 
-        finalResult.match = false;
+        forcaRegex::parsePattern(pattern, *finalPattern);
 
-        if( offset >= subject.length() || subject.empty() ) return finalResult;
+        forcaRegex::compileExpression(*finalPattern);
 
-        std::unique_ptr<forcaRegex::RegexPattern> finalPattern_ptr = createPattern(pattern);
+        forcaRegex::loadPatternInfo(*finalPattern);
 
-        RegexMatchData regex_data;
+        return finalPattern;
 
-        regex_data.match_data = pcre2_match_data_create_from_pattern( finalPattern_ptr->compiled.code, regex_data.gcontext );
+    }
 
-        PCRE2_SPTR subject_string = reinterpret_cast<PCRE2_SPTR>( subject.data() );
+    /**
+     * Cria um RegexPattern a partir de um código já compilado (ex: decodificado com o
+     * pcre2_serialize_decode), sem chamar o pcre2_compile. O RegexPattern assume a posse do código.
+     * 
+     * @param   const std::string& pattern    Padrão regex que originou o código, no formato /pattern/flags
+     * @param   pcre2_code* code              Código compilado
+     * @return  RegexPattern                  Estrutura contendo o padrão compilado e suas configurações
+     * @throws  std::invalid_argument         Se o padrão regex estiver malformado (o código é liberado)
+     */
+    std::unique_ptr<forcaRegex::RegexPattern> createPattern( const std::string& pattern, pcre2_code* code ) {
 
-        PCRE2_SIZE subject_length = static_cast<PCRE2_SIZE>( subject.length() );
+        std::unique_ptr<forcaRegex::RegexPattern> finalPattern = std::make_unique<forcaRegex::RegexPattern>();
 
-        pcre2_match_context *mcontext = nullptr;
+        finalPattern->compiled.code = code;
 
-        int regex_result = pcre2_match( finalPattern_ptr->compiled.code, subject_string, subject_length, offset,
-        0, regex_data.match_data, mcontext );
+        forcaRegex::parsePattern(pattern, *finalPattern);
 
-        // Se não houve match, limpa e retorna
-        if (regex_result <= 0) {
+        forcaRegex::loadPatternInfo(*finalPattern);
 
-            finalResult.match = false;
+        return finalPattern;
 
-            return finalResult;
+    }
 
-        }
+    /**
+     * Cria e compila um padrão a partir de um PatternLiteral, que já tem a expressão e as
+     * flags separadas e validadas (em tempo de compilação), sem nenhum parse.
+     * 
+     * @param   const PatternLiteral& literal    Padrão literal
+     * @return  RegexPattern                     Estrutura contendo o padrão compilado e suas configurações
+     * @throws  std::runtime_error               Se houver erro na compilação do padrão
+     */
+    std::unique_ptr<forcaRegex::RegexPattern> createPattern( const forcaRegex::PatternLiteral& literal ) {
 
-        // Armazena os grupos numéricos
-        PCRE2_SIZE* ovector = pcre2_get_ovector_pointer(regex_data.match_data);
+        std::unique_ptr<forcaRegex::RegexPattern> finalPattern = std::make_unique<forcaRegex::RegexPattern>();
 
-        for (int i = 0; i < regex_result; ++i) {
+        finalPattern->expression.assign( literal.expression.data(), literal.expression.length() );
+        finalPattern->pattern = reinterpret_cast<PCRE2_SPTR>( finalPattern->expression.c_str() );
+        finalPattern->length = static_cast<PCRE2_SIZE>( finalPattern->expression.length() );
+        finalPattern->options = literal.options;
 
-            PCRE2_SIZE start = ovector[2 * i];
-            PCRE2_SIZE end = ovector[2 * i + 1];
+        forcaRegex::compileExpression(*finalPattern);
 
-            std::string match = subject.substr(start, end - start);
+        forcaRegex::loadPatternInfo(*finalPattern);
 
-            finalResult.push(start, end, match, i);
+        return finalPattern;
 
-        }
+    }
 
-        // Armazena os grupos nomeados
-        PCRE2_SPTR name_table;
-        uint32_t namecount;
-        uint32_t name_entry_size;
+    /**
+     * Cria um cache de padrões compilados com a capacidade informada.
+     * 
+     * @param   std::size_t capacity    Quantidade máxima de padrões armazenados (mínimo 1)
+     */
+    RegexPatternCache::RegexPatternCache( std::size_t capacity ) : capacity( capacity == 0 ? 1 : capacity ) {}
 
-        pcre2_pattern_info(finalPattern_ptr->compiled.code, PCRE2_INFO_NAMECOUNT, &namecount);
+    /**
+     * Remove os padrões usados há mais tempo até o cache respeitar a capacidade.
+     * Deve ser chamada com o mutex já travado.
+     */
+    void RegexPatternCache::evict() {
 
-        if (namecount > 0) {
+        while( entries.size() > capacity && !usage.empty() ){
 
-            pcre2_pattern_info(finalPattern_ptr->compiled.code, PCRE2_INFO_NAMETABLE, &name_table);
-            pcre2_pattern_info(finalPattern_ptr->compiled.code, PCRE2_INFO_NAMEENTRYSIZE, &name_entry_size);
+            entries.erase( usage.back() );
 
-            PCRE2_SPTR entry = name_table;
+            usage.pop_back();
 
-            for (uint32_t i = 0; i < namecount; ++i) {
+            evictions++;
 
-                uint16_t group_number = (entry[0] << 8) | entry[1];
-                std::string group_name(reinterpret_cast<const char*>(entry + 2));
+        }
 
-                PCRE2_UCHAR* substr;
-                PCRE2_SIZE substr_length;
+    }
 
-                int res = pcre2_substring_get_bynumber(regex_data.match_data, group_number, &substr, &substr_length);
+    /**
+     * Retorna o padrão compilado correspondente ao pattern informado.
+     * Se o padrão já estiver no cache, ele é marcado como o mais recente e retornado
+     * sem nenhum parse ou compilação. Caso contrário é compilado com createPattern()
+     * e armazenado, removendo o padrão menos usado se o cache estiver cheio.
+     * 
+     * @param   const std::string& pattern    Padrão regex no formato /pattern/flags
+     * @return  std::shared_ptr<const RegexPattern>   Padrão compilado
+     * @throws  std::invalid_argument         Se o padrão regex estiver malformado
+     * @throws  std::runtime_error            Se houver erro na compilação do padrão
+     */
+    std::shared_ptr<const forcaRegex::RegexPattern> RegexPatternCache::get( const std::string& pattern ) {
 
-                if (res == 0) {
+        std::lock_guard<std::mutex> lock(mutex);
 
-                    std::string match(reinterpret_cast<char*>(substr), substr_length);
+        if( !pinned.empty() ){
 
-                    PCRE2_SIZE start = ovector[2 * group_number];
-                    PCRE2_SIZE end = ovector[2 * group_number + 1];
+            auto fixed = pinned.find(pattern);
 
-                    finalResult.push(start, end, match, group_name);
+            if( fixed != pinned.end() ){
 
-                    pcre2_substring_free(substr);
+                hits++;
 
-                }
+                return fixed->second;
 
-                entry += name_entry_size;
             }
 
         }
 
-        if( mcontext != nullptr ) pcre2_match_context_free(mcontext);
+        std::unordered_map< std::string, CacheEntry >::iterator item = entries.find(pattern);
 
-        finalResult.match = true;
+        if( item != entries.end() ){
 
-        return finalResult;
+            hits++;
+
+            // Move a chave para o começo da lista, sem realocar o nó.
+            usage.splice( usage.begin(), usage, item->second.usage );
+
+            return item->second.pattern;
+
+        }
+
+        misses++;
+
+        // Se o padrão for malformado a exceção sobe antes de qualquer alteração no cache.
+        std::shared_ptr<const forcaRegex::RegexPattern> compiled( forcaRegex::createPattern(pattern) );
+
+        usage.push_front(pattern);
+
+        entries[pattern] = CacheEntry{ compiled, usage.begin() };
+
+        evict();
+
+        return compiled;
 
     }
 
     /**
-     * Executa uma busca por um padrão em uma string (todas ocorrências).
-     * Similar à função preg_match_all() do PHP.
-     *
-     * @param pattern  Padrão regex no formato /pattern/flags.
-     * @param subject  String onde será feita a busca.
-     * @param offset   (Opcional) Posição onde iniciar a busca (default: 0).
-     * @param limit    (Opcional) Limite máximo de matches a serem encontrados (default: ilimitado).
-     * @return RegexResult Estrutura contendo os resultados da busca:
-     *         - match: true se encontrou matches, false caso contrário.
-     *         - Grupos numéricos e nomeados acessíveis via get().
-     * @throws std::invalid_argument Se o padrão regex estiver malformado.
-     * @throws std::runtime_error Se houver erro na compilação do padrão.
+     * Armazena um padrão já compilado como fixo: ele não conta na capacidade, não entra no LRU
+     * e não é removido pelo clear(). Usado para os padrões internos pré-compilados.
+     * 
+     * @param   const std::string& pattern                          Padrão regex no formato /pattern/flags (chave)
+     * @param   std::shared_ptr<const RegexPattern> compiled        Padrão compilado
      */
-    forcaRegex::RegexResult preg_match_all( const std::string& pattern, const std::string& subject, PCRE2_SIZE offset, std::size_t limit ) {
+    void RegexPatternCache::pin( const std::string& pattern, std::shared_ptr<const forcaRegex::RegexPattern> compiled ) {
 
-        forcaRegex::RegexResult finalResult;
+        std::lock_guard<std::mutex> lock(mutex);
 
-        finalResult.match = false;
+        // Se o padrão já estava no LRU, passa a existir somente como fixo.
+        std::unordered_map< std::string, CacheEntry >::iterator item = entries.find(pattern);
 
-        if ( offset >= subject.length() || limit == 0 || subject.empty() ) return finalResult;
+        if( item != entries.end() ){
 
-        std::unique_ptr<forcaRegex::RegexPattern> finalPattern_ptr = createPattern(pattern);
+            usage.erase( item->second.usage );
 
-        RegexMatchData regex_data;
+            entries.erase( item );
 
-        regex_data.match_data = pcre2_match_data_create_from_pattern(finalPattern_ptr->compiled.code, regex_data.gcontext);
+        }
 
-        PCRE2_SPTR subject_string = reinterpret_cast<PCRE2_SPTR>(subject.data());
-        PCRE2_SIZE subject_length = static_cast<PCRE2_SIZE>(subject.length());
+        pinned[pattern] = std::move(compiled);
 
-        pcre2_match_context *mcontext = nullptr;
+    }
 
-        bool foundAny = false;
+    /**
+     * Retorna um padrão fixo (ver pin()), sem alterar as estatísticas do cache.
+     * 
+     * @param   const std::string& pattern    Padrão regex no formato /pattern/flags
+     * @return  std::shared_ptr<const RegexPattern>   Padrão compilado, ou nullptr se o padrão não for fixo
+     */
+    std::shared_ptr<const forcaRegex::RegexPattern> RegexPatternCache::pinnedPattern( const std::string& pattern ) {
 
-        std::size_t count = 0;
+        std::lock_guard<std::mutex> lock(mutex);
 
-        while (offset < subject_length) {
-            
-            if (limit == 0 || count >= limit) {
-                break;
-            }
+        auto fixed = pinned.find(pattern);
 
-            int regex_result = pcre2_match(
-                finalPattern_ptr->compiled.code,
-                subject_string,
-                subject_length,
-                offset,
-                0,
-                regex_data.match_data,
-                mcontext
-            );
+        return fixed != pinned.end() ? fixed->second : nullptr;
 
-            if (regex_result <= 0) break;
+    }
 
-            foundAny = true;
+    /**
+     * Altera a capacidade máxima do cache, removendo os padrões excedentes.
+     * 
+     * @param   std::size_t capacity    Nova capacidade (mínimo 1)
+     */
+    void RegexPatternCache::setCapacity( std::size_t capacity ) {
 
-            // Grupos numéricos
-            PCRE2_SIZE* ovector = pcre2_get_ovector_pointer(regex_data.match_data);
+        std::lock_guard<std::mutex> lock(mutex);
 
-            for (int i = 0; i < regex_result; ++i) {
+        this->capacity = capacity == 0 ? 1 : capacity;
 
-                PCRE2_SIZE start = ovector[2 * i];
-                PCRE2_SIZE end = ovector[2 * i + 1];
+        evict();
 
-                std::string match = subject.substr(start, end - start);
+    }
 
-                finalResult.push(start, end, match, i);
+    /**
+     * Remove todos os padrões do cache, exceto os fixos. Os contadores de hits/misses são mantidos.
+     */
+    void RegexPatternCache::clear() {
 
-            }
+        std::lock_guard<std::mutex> lock(mutex);
 
-            // Grupos nomeados
-            PCRE2_SPTR name_table;
-            uint32_t namecount;
-            uint32_t name_entry_size;
+        entries.clear();
 
-            pcre2_pattern_info(finalPattern_ptr->compiled.code, PCRE2_INFO_NAMECOUNT, &namecount);
+        usage.clear();
 
-            if (namecount > 0) {
+    }
 
-                pcre2_pattern_info(finalPattern_ptr->compiled.code, PCRE2_INFO_NAMETABLE, &name_table);
-                pcre2_pattern_info(finalPattern_ptr->compiled.code, PCRE2_INFO_NAMEENTRYSIZE, &name_entry_size);
+    /**
+     * Retorna uma cópia das estatísticas atuais do cache.
+     * 
+     * @return  RegexCacheStats     Hits, misses, remoções, tamanho e capacidade
+     */
+    forcaRegex::RegexCacheStats RegexPatternCache::stats() {
 
-                PCRE2_SPTR entry = name_table;
+        std::lock_guard<std::mutex> lock(mutex);
 
-                for (uint32_t i = 0; i < namecount; ++i) {
+        forcaRegex::RegexCacheStats stats;
 
-                    uint16_t group_number = (entry[0] << 8) | entry[1];
+        stats.hits = hits;
+        stats.misses = misses;
+        stats.evictions = evictions;
+        stats.size = entries.size();
+        stats.capacity = capacity;
+        stats.pinned = pinned.size();
 
-                    std::string group_name(reinterpret_cast<const char*>(entry + 2));
+        return stats;
 
-                    PCRE2_UCHAR* substr;
-                    PCRE2_SIZE substr_length;
+    }
 
-                    int res = pcre2_substring_get_bynumber(regex_data.match_data, group_number, &substr, &substr_length);
-                    
-                    if (res == 0) {
+    /**
+     * Retorna a instância global do cache de padrões, compartilhada por todas as
+     * funções preg_* do namespace.
+     * 
+     * @return  RegexPatternCache&    Cache global de padrões compilados
+     */
+    forcaRegex::RegexPatternCache& patternCache() {
 
-                        std::string match(reinterpret_cast<char*>(substr), substr_length);
+        static forcaRegex::RegexPatternCache cache;
 
-                        PCRE2_SIZE start = ovector[2 * group_number];
-                        PCRE2_SIZE end = ovector[2 * group_number + 1];
+        return cache;
 
-                        finalResult.push(start, end, match, group_name);
+    }
 
-                        pcre2_substring_free(substr);
+#ifndef FORCA_REGEX_NO_BUNDLE
 
-                    }
+    /**
+     * Decodifica de uma vez o bundle dos padrões internos (gerado no build com o pcre2_serialize_encode)
+     * e fixa os padrões no cache global, assim eles nunca passam pelo pcre2_compile.
+     * 
+     * Se o bundle não puder ser decodificado (ex: versão diferente do PCRE2 em tempo de execução)
+     * nada é feito e os padrões são compilados normalmente na primeira vez que forem usados.
+     */
+    static void loadBuiltinBundle() {
 
-                    entry += name_entry_size;
+        const std::size_t count = forcaRegex::builtins::PATTERN_COUNT;
 
-                }
+        if( forcaRegex::builtins::BUNDLE_SIZE == 0 ) return;
 
-            }
+        if( pcre2_serialize_get_number_of_codes( forcaRegex::builtins::BUNDLE ) != static_cast<int32_t>(count) ) return;
 
-            // Atualiza offset
-            PCRE2_SIZE new_offset = ovector[1];
-            
-            if (new_offset <= offset) offset++; // evita loop infinito com zero-width matches
-            else offset = new_offset;
+        std::vector<pcre2_code*> codes(count, nullptr);
 
-            count++;
+        int32_t decoded = pcre2_serialize_decode( codes.data(), static_cast<int32_t>(count), forcaRegex::builtins::BUNDLE, nullptr );
+
+        if( decoded != static_cast<int32_t>(count) ){
+
+            for( pcre2_code* code : codes ) if( code != nullptr ) pcre2_code_free(code);
+
+            return;
 
         }
 
-        if( mcontext != nullptr ) pcre2_match_context_free(mcontext);
+        forcaRegex::RegexPatternCache& cache = forcaRegex::patternCache();
 
-        finalResult.match = foundAny;
+        for( std::size_t i = 0; i < count; i++ ){
 
-        return finalResult;
+            try {
 
-    }
+                std::string source( forcaRegex::builtins::PATTERNS[i].source );
 
-    /**
-     * Realiza substituições em uma string baseadas em um padrão regex.
-     * Similar à função preg_replace() do PHP.
-     *
-     * Suporta referências para grupos capturados no texto de substituição:
-     * - $0: Match completo
-     * - $1, $2, etc: Grupos numéricos
-     * - $name: Grupos nomeados
-     *
-     * @param pattern      Padrão regex no formato /pattern/flags.
-     * @param subject      String onde serão feitas as substituições.
-     * @param replacement  String de substituição (pode conter $0, $1, $name etc).
-     * @param offset       (Opcional) Posição onde iniciar as substituições (default: 0).
-     * @param limit        (Opcional) Limite máximo de substituições a serem realizadas (default: ilimitado).
-     * @return std::string Nova string com as substituições realizadas.
-     * @throws std::invalid_argument Se o padrão regex estiver malformado.
-     * @throws std::runtime_error Se houver erro na compilação do padrão.
-     */
-    std::string preg_replace( const std::string& pattern, const std::string& subject, const std::string& replacement, PCRE2_SIZE offset, std::size_t limit ) {
+                cache.pin( source, forcaRegex::createPattern( source, codes[i] ) );
 
-        if(subject.empty() || limit == 0) return subject;
+            } catch (...) {
 
-        RegexResult result;
+                // O código já foi liberado pelo RegexPattern, o padrão só vai ser compilado normalmente.
+
+            }
 
-        // Otimização para quando limit for igual a 1, usando o preg_match que é mais rápido.
-        if(limit == 1){
-            result = preg_match(pattern, subject, offset);
-        }
-        else{
-            result = preg_match_all(pattern, subject, offset, limit);
         }
 
-        if (!result.match) return subject;
+    }
 
-        std::string output;
-        std::string::size_type last_pos = 0;
+#endif
 
-        std::vector<forcaRegex::RegexStructData>* full_matches = result.get(0);
+    /**
+     * Carrega o bundle de padrões internos uma única vez por processo (na primeira busca de padrão).
+     */
+    static void ensureBuiltinBundle() {
 
-        if ( full_matches == nullptr ) return subject;
+        #ifndef FORCA_REGEX_NO_BUNDLE
 
-        std::size_t count = 0;
+            static std::once_flag bundleLoaded;
 
-        for (const auto& match_data : *full_matches) {
+            std::call_once( bundleLoaded, forcaRegex::loadBuiltinBundle );
 
-            if (limit == 0 || count >= limit) {
-                break;
-            }
+        #endif
 
-            // Adiciona parte do subject entre o último match e o início do atual
-            output += subject.substr(last_pos, match_data.start - last_pos);
+    }
 
-            // Constrói substituição
-            std::string replaced = replacement;
+    /**
+     * Atalho para buscar um padrão compilado no cache global.
+     * 
+     * @param   const std::string& pattern    Padrão regex no formato /pattern/flags
+     * @return  std::shared_ptr<const RegexPattern>   Padrão compilado
+     * @throws  std::invalid_argument         Se o padrão regex estiver malformado
+     * @throws  std::runtime_error            Se houver erro na compilação do padrão
+     */
+    std::shared_ptr<const forcaRegex::RegexPattern> getPattern( const std::string& pattern ) {
 
-            // Substituição de grupos posicionais: $0, $1, ...
-            for (int group_id : result.int_keys) {
+        forcaRegex::ensureBuiltinBundle();
 
-                auto group = result.get(group_id);
+        return forcaRegex::patternCache().get(pattern);
 
-                if (!group || group->empty()) continue;
+    }
 
-                std::string tag = "$" + std::to_string(group_id);
+    /**
+     * Compila um PatternLiteral. Se o padrão fizer parte do bundle de padrões internos,
+     * o código já decodificado é reaproveitado. Usado pelo StaticPattern, que guarda o resultado.
+     * 
+     * @param   const PatternLiteral& literal    Padrão literal
+     * @return  std::shared_ptr<const RegexPattern>   Padrão compilado
+     * @throws  std::runtime_error               Se houver erro na compilação do padrão
+     */
+    std::shared_ptr<const forcaRegex::RegexPattern> compileLiteral( const forcaRegex::PatternLiteral& literal ) {
 
-                std::string::size_type pos = 0;
+        forcaRegex::ensureBuiltinBundle();
 
-                while ((pos = replaced.find(tag, pos)) != std::string::npos) {
+        std::shared_ptr<const forcaRegex::RegexPattern> pinned = forcaRegex::patternCache().pinnedPattern( std::string(literal.source) );
 
-                    replaced.replace(pos, tag.size(), (*group)[&match_data - &(*full_matches)[0]].match);
-                    pos += (*group)[&match_data - &(*full_matches)[0]].match.size();
+        if( pinned ) return pinned;
 
-                }
+        return forcaRegex::createPattern(literal);
 
-            }
+    }
 
-            // Substituição de grupos nomeados: $name, $email, etc.
-            for (const std::string& name : result.string_keys) {
+    /**
+     * Switch global do JIT. Quando desligado, os padrões novos não são compilados pelo JIT
+     * e os já compilados passam a executar pelo interpretador.
+     */
+    static std::atomic<bool> JIT_ENABLED(true);
 
-                auto group = result.get(name);
+    /**
+     * Verifica se a biblioteca PCRE2 foi compilada com suporte ao JIT nesta plataforma.
+     * O resultado é calculado uma única vez.
+     * 
+     * @return  bool    true se o JIT estiver disponível
+     */
+    bool jitAvailable() {
 
-                if (!group || group->empty()) continue;
+        static const bool available = []() -> bool {
 
-                std::string tag = "$" + name;
+            uint32_t jit = 0;
 
-                std::string::size_type pos = 0;
+            return pcre2_config(PCRE2_CONFIG_JIT, &jit) >= 0 && jit == 1;
 
-                while ((pos = replaced.find(tag, pos)) != std::string::npos) {
+        }();
 
-                    replaced.replace(pos, tag.size(), (*group)[&match_data - &(*full_matches)[0]].match);
-                    pos += (*group)[&match_data - &(*full_matches)[0]].match.size();
+        return available;
 
-                }
+    }
 
-            }
+    /**
+     * Liga ou desliga o uso do JIT em todas as funções preg_*.
+     * 
+     * @param   bool enabled    true para usar o JIT (padrão), false para usar somente o interpretador
+     */
+    void setJITEnabled( bool enabled ) {
 
-            output += replaced;
-            last_pos = match_data.end;
-            count++;
+        JIT_ENABLED.store(enabled, std::memory_order_relaxed);
 
-        }
+    }
 
-        // Adiciona o restante do subject após o último match
-        output += subject.substr(last_pos);
-        return output;
+    /**
+     * Indica se o JIT está disponível e habilitado.
+     * 
+     * @return  bool    true se os matches podem executar via JIT
+     */
+    bool isJITEnabled() {
+
+        return JIT_ENABLED.load(std::memory_order_relaxed) && forcaRegex::jitAvailable();
 
     }
 
     /**
-     * Divide uma string em substrings usando um padrão regex como delimitador.
-     * Similar à função preg_split() do PHP.
-     *
-     * @param pattern  Padrão regex usado como delimitador.
-     * @param subject  String a ser dividida.
-     * @param limit    (Opcional) Limite máximo de divisões (default: ilimitado).
-     * @return std::vector<std::string> Vetor contendo as substrings resultantes.
+     * Retorna uma pilha do pool, criando uma nova se não houver nenhuma ociosa.
+     * 
+     * @return  pcre2_jit_stack*    Pilha do JIT, ou nullptr se não foi possível alocar
      */
-    std::vector<std::string> preg_split( const std::string& pattern, const std::string& subject, std::size_t limit ) {
+    pcre2_jit_stack* RegexJITStackPool::acquire() {
 
-        if(subject.empty() || limit == 0) return std::vector<std::string>{subject};
+        {
 
-        RegexResult result;
+            std::lock_guard<std::mutex> lock(mutex);
 
-        // Otimização para quando limit for igual a 1, usando o preg_match que é mais rápido.
-        if(limit == 1){
-            result = preg_match(pattern, subject, 0);
-        }
-        else{
-            result = preg_match_all(pattern, subject, 0, limit);
-        }
+            if( !stacks.empty() ){
 
-        if (!result.match) return std::vector<std::string>{subject};
+                pcre2_jit_stack *stack = stacks.back();
 
-        std::vector<RegexStructData>* complete_matches = result.get(0);
+                stacks.pop_back();
 
-        if( complete_matches == nullptr ) return std::vector<std::string>{subject};
+                return stack;
 
-        std::size_t i, matchesLength = complete_matches->size();
+            }
 
-        std::vector<std::string> explode;
+        }
 
-        std::string copy = subject;
+        return pcre2_jit_stack_create(START_SIZE, MAX_SIZE, nullptr);
 
-        std::string::size_type offset = 0;
+    }
 
-        for(i=0; i<matchesLength; i++){
+    /**
+     * Devolve uma pilha ao pool. Se o pool já tiver pilhas ociosas suficientes a pilha é liberada.
+     * 
+     * @param   pcre2_jit_stack* stack    Pilha a ser devolvida
+     */
+    void RegexJITStackPool::release( pcre2_jit_stack* stack ) {
 
-            if(i >= limit || offset >= copy.length()) break;
+        if( stack == nullptr ) return;
 
-            if(i + 1 < limit){
+        {
 
-                std::string::size_type start = complete_matches->at(i).start;
-    
-                std::string::size_type end = complete_matches->at(i).end;
+            std::lock_guard<std::mutex> lock(mutex);
 
-                std::string substring = copy.substr( offset, (start - offset) );
+            if( stacks.size() < MAX_IDLE ){
 
-                explode.push_back(substring);
+                stacks.push_back(stack);
 
-                offset = end;
+                return;
 
             }
-            else{
-                explode.push_back( copy.substr(offset) );
-            }
 
         }
 
-        if(explode.empty()) explode.push_back(copy);
+        pcre2_jit_stack_free(stack);
 
-        return explode;
+    }
+
+    /**
+     * Pool global de pilhas do JIT. Fica alocado até o fim do processo, assim threads
+     * que terminam depois da destruição dos objetos estáticos ainda podem devolver suas pilhas.
+     * 
+     * @return  RegexJITStackPool&
+     */
+    static forcaRegex::RegexJITStackPool& jitStackPool() {
+
+        static forcaRegex::RegexJITStackPool *pool = new forcaRegex::RegexJITStackPool();
+
+        return *pool;
+
+    }
+
+    RegexThreadContext::RegexThreadContext() {
+
+        gcontext = pcre2_general_context_create(nullptr, nullptr, nullptr);
+
+        mcontext = pcre2_match_context_create(gcontext);
+
+    }
+
+    RegexThreadContext::~RegexThreadContext() {
+
+        if( match_data != nullptr ) pcre2_match_data_free(match_data);
+
+        if( mcontext != nullptr ) pcre2_match_context_free(mcontext);
+
+        if( jit_stack != nullptr ) jitStackPool().release(jit_stack);
+
+        if( gcontext != nullptr ) pcre2_general_context_free(gcontext);
+
+    }
+
+    /**
+     * Retorna o match_data da thread com espaço para o grupo 0 e todos os grupos de captura
+     * do padrão. O bloco só é realocado quando o padrão tem mais grupos do que o maior já visto.
+     * 
+     * @param   const RegexPattern& pattern     Padrão que será executado
+     * @return  pcre2_match_data*               Bloco reaproveitado
+     * @throws  std::bad_alloc                  Se não for possível alocar o bloco
+     */
+    pcre2_match_data* RegexThreadContext::matchData( const forcaRegex::RegexPattern& pattern ) {
+
+        uint32_t needed = pattern.compiled.captures + 1;
+
+        if( match_data == nullptr || needed > pairs ){
+
+            if( match_data != nullptr ) pcre2_match_data_free(match_data);
+
+            match_data = pcre2_match_data_create(needed, gcontext);
+
+            pairs = match_data != nullptr ? needed : 0;
+
+            if( match_data == nullptr ) throw std::bad_alloc();
+
+        }
+
+        return match_data;
+
+    }
+
+    /**
+     * Retorna o contexto de execução da thread atual, criado na primeira chamada.
+     * 
+     * @return  RegexThreadContext&
+     */
+    forcaRegex::RegexThreadContext& threadContext() {
+
+        thread_local forcaRegex::RegexThreadContext context;
+
+        return context;
+
+    }
+
+    /**
+     * Limites globais de execução, usados quando a thread não tem um RegexLimitsScope ativo.
+     */
+    static std::atomic<uint32_t> DEFAULT_MATCH_LIMIT( forcaRegex::RegexLimits::DEFAULT_MATCH );
+    static std::atomic<uint32_t> DEFAULT_DEPTH_LIMIT( forcaRegex::RegexLimits::DEFAULT_DEPTH );
+    static std::atomic<uint32_t> DEFAULT_HEAP_LIMIT( forcaRegex::RegexLimits::DEFAULT_HEAP );
+
+    /**
+     * Altera os limites globais de execução usados por todas as funções preg_*.
+     * 
+     * @param   const RegexLimits& limits    Novos limites
+     */
+    void setDefaultLimits( const forcaRegex::RegexLimits& limits ) {
+
+        DEFAULT_MATCH_LIMIT.store(limits.match, std::memory_order_relaxed);
+        DEFAULT_DEPTH_LIMIT.store(limits.depth, std::memory_order_relaxed);
+        DEFAULT_HEAP_LIMIT.store(limits.heap, std::memory_order_relaxed);
+
+    }
+
+    /**
+     * Retorna os limites globais de execução.
+     * 
+     * @return  RegexLimits
+     */
+    forcaRegex::RegexLimits getDefaultLimits() {
+
+        forcaRegex::RegexLimits limits;
+
+        limits.match = DEFAULT_MATCH_LIMIT.load(std::memory_order_relaxed);
+        limits.depth = DEFAULT_DEPTH_LIMIT.load(std::memory_order_relaxed);
+        limits.heap = DEFAULT_HEAP_LIMIT.load(std::memory_order_relaxed);
+
+        return limits;
+
+    }
+
+    RegexLimitsScope::RegexLimitsScope( const forcaRegex::RegexLimits& limits ) : limits( limits ) {
+
+        forcaRegex::RegexThreadContext& context = forcaRegex::threadContext();
+
+        previous = context.limits;
+
+        context.limits = &this->limits;
+
+    }
+
+    RegexLimitsScope::~RegexLimitsScope() {
+
+        forcaRegex::threadContext().limits = previous;
+
+    }
+
+    /**
+     * Lança RegexLimitError se o retorno do pcre2_match indicar que algum limite foi atingido.
+     * 
+     * @param   int result    Retorno do pcre2_match
+     * @throws  RegexLimitError
+     */
+    static void checkLimitError( int result ) {
+
+        if( result != PCRE2_ERROR_MATCHLIMIT && result != PCRE2_ERROR_DEPTHLIMIT && result != PCRE2_ERROR_HEAPLIMIT ) return;
+
+        PCRE2_UCHAR buffer[256];
+
+        std::string message = "Limite de execução da regex atingido";
+
+        if( pcre2_get_error_message(result, buffer, sizeof(buffer)) >= 0 ){
+            message += ": ";
+            message += reinterpret_cast<char*>(buffer);
+        }
+
+        throw forcaRegex::RegexLimitError(message, result);
+
+    }
+
+    /**
+     * Executa o pcre2_match de um padrão compilado, usando o JIT sempre que possível.
+     * 
+     * Se o padrão foi compilado pelo JIT e o JIT estiver habilitado, a pilha do JIT da thread
+     * é associada ao match context. Se o JIT não puder ser usado (desabilitado, sem pilha ou
+     * estouro da pilha) o match é executado pelo interpretador, com o mesmo resultado.
+     * 
+     * Os limites de execução (do RegexLimitsScope ativo ou os globais) são aplicados no match context.
+     * 
+     * @param   const RegexPattern& pattern     Padrão compilado
+     * @param   const std::string& subject      String onde será feita a busca
+     * @param   PCRE2_SIZE offset               Posição onde iniciar a busca
+     * @param   pcre2_match_data* match_data    Bloco que receberá o ovector
+     * @return  int                             Retorno do pcre2_match
+     * @throws  RegexLimitError                 Se o match estourar algum dos limites de execução
+     */
+    int executeMatch( const forcaRegex::RegexPattern& pattern, const std::string& subject, PCRE2_SIZE offset, pcre2_match_data *match_data ) {
+
+        forcaRegex::RegexThreadContext& context = forcaRegex::threadContext();
+
+        if( context.mcontext != nullptr ){
+
+            forcaRegex::RegexLimits limits = context.limits != nullptr ? *context.limits : forcaRegex::getDefaultLimits();
+
+            pcre2_set_match_limit(context.mcontext, limits.match);
+            pcre2_set_depth_limit(context.mcontext, limits.depth);
+            pcre2_set_heap_limit(context.mcontext, limits.heap);
+
+        }
+
+        PCRE2_SPTR subject_string = reinterpret_cast<PCRE2_SPTR>( subject.data() );
+
+        PCRE2_SIZE subject_length = static_cast<PCRE2_SIZE>( subject.length() );
+
+        bool useJIT = pattern.compiled.jit && forcaRegex::isJITEnabled() && context.mcontext != nullptr;
+
+        if( useJIT && context.jit_stack == nullptr ){
+
+            context.jit_stack = jitStackPool().acquire();
+
+            if( context.jit_stack != nullptr ) pcre2_jit_stack_assign(context.mcontext, nullptr, context.jit_stack);
+
+        }
+
+        if( useJIT && context.jit_stack != nullptr ){
+
+            int result = pcre2_match( pattern.compiled.code, subject_string, subject_length, offset, 0, match_data, context.mcontext );
+
+            // Padrões que estouram a pilha do JIT ainda podem ser resolvidos pelo interpretador.
+            if( result != PCRE2_ERROR_JIT_STACKLIMIT ){
+
+                forcaRegex::checkLimitError(result);
+
+                return result;
+
+            }
+
+        }
+
+        int result = pcre2_match( pattern.compiled.code, subject_string, subject_length, offset, PCRE2_NO_JIT, match_data, context.mcontext );
+
+        forcaRegex::checkLimitError(result);
+
+        return result;
+
+    }
+
+    /**
+     * Procura um grupo nomeado na tabela do padrão (busca binária).
+     * 
+     * @param   const RegexPattern& pattern    Padrão compilado
+     * @param   std::string_view name          Nome do grupo
+     * @return  int                            Número do grupo, ou -1 se não existir
+     */
+    static int findGroupName( const forcaRegex::RegexPattern& pattern, std::string_view name ) {
+
+        const auto& names = pattern.names;
+
+        auto it = std::lower_bound( names.begin(), names.end(), name, 
+            []( const std::pair<std::string, uint32_t>& entry, std::string_view value ){
+                return std::string_view(entry.first) < value;
+            }
+        );
+
+        if( it == names.end() || it->first != name ) return -1;
+
+        return static_cast<int>(it->second);
+
+    }
+
+    /**
+     * Cria um resultado vazio ligado ao padrão e ao subject da busca.
+     * 
+     * @param   std::shared_ptr<const RegexPattern> pattern    Padrão usado na busca
+     * @param   std::string_view subject                       String onde a busca foi feita
+     */
+    RegexMatches::RegexMatches( std::shared_ptr<const forcaRegex::RegexPattern> pattern, std::string_view subject )
+        : pattern( std::move(pattern) ), subject( subject ) {
+
+        groups = this->pattern ? this->pattern->compiled.captures + 1 : 0;
+
+    }
+
+    /**
+     * Adiciona um match a partir do ovector do PCRE2.
+     * Durante a busca os offsets ficam organizados por match, finalize() reorganiza por grupo.
+     * Grupos acima do retorno do pcre2_match não participaram do match e ficam como PCRE2_UNSET.
+     * 
+     * @param   const PCRE2_SIZE* ovector    Ovector do match
+     * @param   int count                    Retorno do pcre2_match (quantidade de pares válidos)
+     */
+    void RegexMatches::append( const PCRE2_SIZE* ovector, int count ) {
+
+        for( uint32_t i = 0; i < groups; i++ ){
+
+            if( i < static_cast<uint32_t>(count) ){
+
+                offsets.push_back( ovector[2 * i] );
+                offsets.push_back( ovector[2 * i + 1] );
+
+            }
+            else{
+
+                offsets.push_back( PCRE2_UNSET );
+                offsets.push_back( PCRE2_UNSET );
+
+            }
+
+        }
+
+        matches++;
+
+        match = true;
+
+    }
+
+    /**
+     * Reorganiza os offsets por grupo (todos os matches do grupo 0, depois do grupo 1, etc),
+     * que é o formato usado pelos acessores. Com um único match os dois formatos são iguais.
+     */
+    void RegexMatches::finalize() {
+
+        if( transposed ) return;
+
+        transposed = true;
+
+        if( matches <= 1 || groups <= 1 ) return;
+
+        std::vector<PCRE2_SIZE> byGroup( offsets.size() );
+
+        for( std::size_t m = 0; m < matches; m++ ){
+
+            for( uint32_t g = 0; g < groups; g++ ){
+
+                byGroup[ (g * matches + m) * 2 ] = offsets[ (m * groups + g) * 2 ];
+                byGroup[ (g * matches + m) * 2 + 1 ] = offsets[ (m * groups + g) * 2 + 1 ];
+
+            }
+
+        }
+
+        offsets.swap(byGroup);
+
+    }
+
+    /**
+     * Retorna o número de um grupo nomeado usando a tabela do padrão (busca binária).
+     * 
+     * @param   std::string_view name    Nome do grupo
+     * @return  int                      Número do grupo, ou -1 se não existir
+     */
+    int RegexMatches::groupIndex( std::string_view name ) const {
+
+        if( !pattern ) return -1;
+
+        return forcaRegex::findGroupName(*pattern, name);
+
+    }
+
+    /**
+     * Materializa o resultado no formato antigo, copiando cada captura.
+     * Todos os grupos recebem uma entrada por match (grupos que não participaram ficam com
+     * a string vazia e posições PCRE2_UNSET), assim os índices ficam alinhados entre os grupos.
+     * 
+     * @return  RegexResult
+     */
+    forcaRegex::RegexResult RegexMatches::toResult() const {
+
+        forcaRegex::RegexResult result;
+
+        result.match = match;
+
+        if( !match ) return result;
+
+        for( uint32_t g = 0; g < groups; g++ ){
+
+            for( std::size_t m = 0; m < matches; m++ ){
+
+                result.push( start(g, m), end(g, m), copy(g, m), static_cast<int>(g) );
+
+            }
+
+        }
+
+        for( const auto& name : pattern->names ){
+
+            for( std::size_t m = 0; m < matches; m++ ){
+
+                result.push( start(name.second, m), end(name.second, m), copy(name.second, m), name.first );
+
+            }
+
+        }
+
+        return result;
+
+    }
+
+    /**
+     * Executa uma busca (primeira ocorrência) guardando somente os offsets das capturas.
+     * 
+     * @param   std::shared_ptr<const RegexPattern> pattern    Padrão já compilado
+     * @param   const std::string& subject                     String onde será feita a busca
+     * @param   PCRE2_SIZE offset                              Posição onde iniciar a busca (default: 0)
+     * @return  RegexMatches                                   Resultado com as capturas como views do subject
+     */
+    forcaRegex::RegexMatches preg_match_offsets( const std::shared_ptr<const forcaRegex::RegexPattern>& pattern, const std::string& subject, PCRE2_SIZE offset ) {
+
+        forcaRegex::RegexMatches finalResult(pattern, subject);
+
+        if( offset >= subject.length() || subject.empty() ) return finalResult;
+
+        pcre2_match_data *match_data = forcaRegex::threadContext().matchData(*pattern);
+
+        int regex_result = forcaRegex::executeMatch( *pattern, subject, offset, match_data );
+
+        if( regex_result > 0 ) finalResult.append( pcre2_get_ovector_pointer(match_data), regex_result );
+
+        finalResult.finalize();
+
+        return finalResult;
+
+    }
+
+    /**
+     * Executa uma busca (primeira ocorrência) guardando somente os offsets das capturas.
+     * 
+     * @param   const std::string& pattern    Padrão regex no formato /pattern/flags
+     * @param   const std::string& subject    String onde será feita a busca
+     * @param   PCRE2_SIZE offset             Posição onde iniciar a busca (default: 0)
+     * @return  RegexMatches                  Resultado com as capturas como views do subject
+     * @throws  std::invalid_argument         Se o padrão regex estiver malformado
+     * @throws  std::runtime_error            Se houver erro na compilação do padrão
+     */
+    forcaRegex::RegexMatches preg_match_offsets( const std::string& pattern, const std::string& subject, PCRE2_SIZE offset ) {
+
+        if( offset >= subject.length() || subject.empty() ) return forcaRegex::RegexMatches();
+
+        return forcaRegex::preg_match_offsets( forcaRegex::getPattern(pattern), subject, offset );
+
+    }
+
+    /**
+     * Executa uma busca (todas ocorrências) guardando somente os offsets das capturas.
+     * 
+     * @param   std::shared_ptr<const RegexPattern> pattern    Padrão já compilado
+     * @param   const std::string& subject                     String onde será feita a busca
+     * @param   PCRE2_SIZE offset                              Posição onde iniciar a busca (default: 0)
+     * @param   std::size_t limit                              Limite máximo de matches (default: ilimitado)
+     * @return  RegexMatches                                   Resultado com as capturas como views do subject
+     */
+    forcaRegex::RegexMatches preg_match_all_offsets( const std::shared_ptr<const forcaRegex::RegexPattern>& pattern, const std::string& subject, PCRE2_SIZE offset, std::size_t limit ) {
+
+        forcaRegex::RegexMatches finalResult(pattern, subject);
+
+        if ( offset >= subject.length() || limit == 0 || subject.empty() ) return finalResult;
+
+        pcre2_match_data *match_data = forcaRegex::threadContext().matchData(*pattern);
+
+        PCRE2_SIZE subject_length = static_cast<PCRE2_SIZE>(subject.length());
+
+        std::size_t count = 0;
+
+        while( offset < subject_length && count < limit ){
+
+            int regex_result = forcaRegex::executeMatch( *pattern, subject, offset, match_data );
+
+            if (regex_result <= 0) break;
+
+            PCRE2_SIZE* ovector = pcre2_get_ovector_pointer(match_data);
+
+            finalResult.append(ovector, regex_result);
+
+            // Atualiza offset
+            PCRE2_SIZE new_offset = ovector[1];
+            
+            if (new_offset <= offset) offset++; // evita loop infinito com zero-width matches
+            else offset = new_offset;
+
+            count++;
+
+        }
+
+        finalResult.finalize();
+
+        return finalResult;
+
+    }
+
+    /**
+     * Executa uma busca (todas ocorrências) guardando somente os offsets das capturas.
+     * 
+     * @param   const std::string& pattern    Padrão regex no formato /pattern/flags
+     * @param   const std::string& subject    String onde será feita a busca
+     * @param   PCRE2_SIZE offset             Posição onde iniciar a busca (default: 0)
+     * @param   std::size_t limit             Limite máximo de matches (default: ilimitado)
+     * @return  RegexMatches                  Resultado com as capturas como views do subject
+     * @throws  std::invalid_argument         Se o padrão regex estiver malformado
+     * @throws  std::runtime_error            Se houver erro na compilação do padrão
+     */
+    forcaRegex::RegexMatches preg_match_all_offsets( const std::string& pattern, const std::string& subject, PCRE2_SIZE offset, std::size_t limit ) {
+
+        if ( offset >= subject.length() || limit == 0 || subject.empty() ) return forcaRegex::RegexMatches();
+
+        return forcaRegex::preg_match_all_offsets( forcaRegex::getPattern(pattern), subject, offset, limit );
+
+    }
+
+    /**
+     * Executa uma busca por um padrão em uma string (primeira ocorrência).
+     * Similar à função preg_match() do PHP.
+     * * @param   const std::string& pattern    Padrão regex no formato /pattern/flags
+     * @param   const std::string& subject    String onde será feita a busca
+     * @param   PCRE2_SIZE offset            Posição onde iniciar a busca (default: 0)
+     * @return  RegexResult                   Estrutura contendo os resultados da busca
+     * - match: true se encontrou match, false caso contrário
+     * - Grupos numéricos e nomeados acessíveis via get()
+     * @throws  std::invalid_argument         Se o padrão regex estiver malformado
+     * @throws  std::runtime_error           Se houver erro na compilação do padrão
+     */
+    forcaRegex::RegexResult preg_match( const std::string& pattern, const std::string& subject, PCRE2_SIZE offset ) {
+
+        return forcaRegex::preg_match_offsets(pattern, subject, offset).toResult();
+
+    }
+
+    /**
+     * Igual ao preg_match(), usando um padrão já compilado (ex: StaticPattern).
+     */
+    forcaRegex::RegexResult preg_match( const std::shared_ptr<const forcaRegex::RegexPattern>& pattern, const std::string& subject, PCRE2_SIZE offset ) {
+
+        return forcaRegex::preg_match_offsets(pattern, subject, offset).toResult();
+
+    }
+
+    /**
+     * Executa uma busca por um padrão em uma string (todas ocorrências).
+     * Similar à função preg_match_all() do PHP.
+     *
+     * @param pattern  Padrão regex no formato /pattern/flags.
+     * @param subject  String onde será feita a busca.
+     * @param offset   (Opcional) Posição onde iniciar a busca (default: 0).
+     * @param limit    (Opcional) Limite máximo de matches a serem encontrados (default: ilimitado).
+     * @return RegexResult Estrutura contendo os resultados da busca:
+     *         - match: true se encontrou matches, false caso contrário.
+     *         - Grupos numéricos e nomeados acessíveis via get().
+     * @throws std::invalid_argument Se o padrão regex estiver malformado.
+     * @throws std::runtime_error Se houver erro na compilação do padrão.
+     */
+    forcaRegex::RegexResult preg_match_all( const std::string& pattern, const std::string& subject, PCRE2_SIZE offset, std::size_t limit ) {
+
+        return forcaRegex::preg_match_all_offsets(pattern, subject, offset, limit).toResult();
+
+    }
+
+    /**
+     * Igual ao preg_match_all(), usando um padrão já compilado (ex: StaticPattern).
+     */
+    forcaRegex::RegexResult preg_match_all( const std::shared_ptr<const forcaRegex::RegexPattern>& pattern, const std::string& subject, PCRE2_SIZE offset, std::size_t limit ) {
+
+        return forcaRegex::preg_match_all_offsets(pattern, subject, offset, limit).toResult();
+
+    }
+
+    /**
+     * Pré-processa o texto de substituição, dividindo-o em literais e referências a grupos do padrão.
+     * 
+     * @param   const RegexPattern& pattern        Padrão compilado (usado para resolver os grupos)
+     * @param   const std::string& replacement     Texto de substituição (pode conter $0, $1, ${1}, $name, ${name})
+     */
+    RegexReplacement::RegexReplacement( const forcaRegex::RegexPattern& pattern, const std::string& replacement ) : text( replacement ) {
+
+        const uint32_t groups = pattern.compiled.captures + 1;
+
+        const std::size_t textLength = text.length();
+
+        std::size_t i = 0, literalStart = 0;
+
+        auto pushLiteral = [&]( std::size_t literalEnd ){
+
+            if( literalEnd <= literalStart ) return;
+
+            tokens.push_back( { literalStart, literalEnd - literalStart, -1 } );
+
+            literals += literalEnd - literalStart;
+
+        };
+
+        auto isDigit = []( char c ){ return c >= '0' && c <= '9'; };
+
+        auto isNameChar = []( char c ){ return std::isalnum( static_cast<unsigned char>(c) ) || c == '_'; };
+
+        while( i < textLength ){
+
+            if( text[i] != '$' || i + 1 >= textLength ){
+                i++;
+                continue;
+            }
+
+            char next = text[i + 1];
+
+            int group = -1;
+
+            std::size_t referenceEnd = i + 1;
+
+            if( isDigit(next) ){
+
+                // $n ou $nn: o número de dois dígitos só é usado se o grupo existir.
+                uint32_t value = next - '0';
+
+                referenceEnd = i + 2;
+
+                if( referenceEnd < textLength && isDigit( text[referenceEnd] ) ){
+
+                    uint32_t twoDigits = value * 10 + ( text[referenceEnd] - '0' );
+
+                    if( twoDigits < groups ){
+                        value = twoDigits;
+                        referenceEnd++;
+                    }
+
+                }
+
+                if( value < groups ) group = static_cast<int>(value);
+
+            }
+            else if( next == '{' ){
+
+                std::size_t close = text.find('}', i + 2);
+
+                if( close != std::string::npos ){
+
+                    std::string_view inner( text.data() + i + 2, close - (i + 2) );
+
+                    if( !inner.empty() && inner.length() <= 5 && std::all_of( inner.begin(), inner.end(), isDigit ) ){
+
+                        uint32_t value = static_cast<uint32_t>( std::stoul( std::string(inner) ) );
+
+                        if( value < groups ) group = static_cast<int>(value);
+
+                    }
+                    else if( !inner.empty() ){
+
+                        group = forcaRegex::findGroupName(pattern, inner);
+
+                    }
+
+                    referenceEnd = close + 1;
+
+                }
+
+            }
+            else if( isNameChar(next) ){
+
+                // $name: usa o maior nome de grupo existente que seja prefixo do identificador.
+                std::size_t nameEnd = i + 1;
+
+                while( nameEnd < textLength && isNameChar( text[nameEnd] ) ) nameEnd++;
+
+                for( std::size_t length = nameEnd - (i + 1); length > 0 && group < 0; length-- ){
+
+                    group = forcaRegex::findGroupName( pattern, std::string_view( text.data() + i + 1, length ) );
+
+                    referenceEnd = i + 1 + length;
+
+                }
+
+            }
+
+            // Referência inválida ou para um grupo inexistente: o '$' fica como literal.
+            if( group < 0 ){
+                i++;
+                continue;
+            }
+
+            pushLiteral(i);
+
+            tokens.push_back( { 0, 0, group } );
+
+            i = literalStart = referenceEnd;
+
+        }
+
+        pushLiteral(textLength);
+
+    }
+
+    /**
+     * Calcula o tamanho exato da substituição de um match.
+     * 
+     * @param   const RegexMatches& matches    Resultado da busca
+     * @param   std::size_t index              Índice do match
+     * @return  std::size_t                    Tamanho em bytes
+     */
+    std::size_t RegexReplacement::length( const forcaRegex::RegexMatches& matches, std::size_t index ) const {
+
+        std::size_t total = literals;
+
+        for( const Token& token : tokens ){
+
+            if( token.group >= 0 ) total += matches.view( static_cast<uint32_t>(token.group), index ).length();
+
+        }
+
+        return total;
+
+    }
+
+    /**
+     * Escreve a substituição de um match no final do buffer de saída.
+     * 
+     * @param   std::string& output            Buffer de saída
+     * @param   const RegexMatches& matches    Resultado da busca
+     * @param   std::size_t index              Índice do match
+     */
+    void RegexReplacement::appendTo( std::string& output, const forcaRegex::RegexMatches& matches, std::size_t index ) const {
+
+        for( const Token& token : tokens ){
+
+            if( token.group < 0 ){
+                output.append( text, token.start, token.length );
+            }
+            else{
+                output.append( matches.view( static_cast<uint32_t>(token.group), index ) );
+            }
+
+        }
+
+    }
+
+    /**
+     * Realiza substituições em uma string usando um padrão já compilado.
+     * O replacement é processado uma única vez e a saída é montada em uma única passada,
+     * em um buffer reservado com o tamanho final exato.
+     *
+     * @param pattern      Padrão já compilado.
+     * @param subject      String onde serão feitas as substituições.
+     * @param replacement  String de substituição (pode conter $0, $1, ${1}, $name, ${name}).
+     * @param offset       (Opcional) Posição onde iniciar as substituições (default: 0).
+     * @param limit        (Opcional) Limite máximo de substituições a serem realizadas (default: ilimitado).
+     * @return std::string Nova string com as substituições realizadas.
+     */
+    std::string preg_replace( const std::shared_ptr<const forcaRegex::RegexPattern>& pattern, const std::string& subject, const std::string& replacement, PCRE2_SIZE offset, std::size_t limit ) {
+
+        if(subject.empty() || limit == 0) return subject;
+
+        forcaRegex::RegexMatches result;
+
+        // Otimização para quando limit for igual a 1, fazendo uma única busca.
+        if(limit == 1){
+            result = forcaRegex::preg_match_offsets(pattern, subject, offset);
+        }
+        else{
+            result = forcaRegex::preg_match_all_offsets(pattern, subject, offset, limit);
+        }
+
+        if (!result.match) return subject;
+
+        forcaRegex::RegexReplacement tokens(*pattern, replacement);
+
+        std::size_t i, matchesLength = result.size();
+
+        std::size_t finalLength = subject.length();
+
+        for(i=0; i<matchesLength; i++){
+
+            finalLength = finalLength - ( result.end(0, i) - result.start(0, i) ) + tokens.length(result, i);
+
+        }
+
+        std::string output;
+
+        output.reserve(finalLength);
+
+        std::string::size_type last_pos = 0;
+
+        for(i=0; i<matchesLength; i++){
+
+            // Adiciona parte do subject entre o último match e o início do atual
+            output.append( subject, last_pos, result.start(0, i) - last_pos );
+
+            tokens.appendTo(output, result, i);
+
+            last_pos = result.end(0, i);
+
+        }
+
+        // Adiciona o restante do subject após o último match
+        output.append( subject, last_pos, std::string::npos );
+
+        return output;
+
+    }
+
+    /**
+     * Realiza substituições em uma string baseadas em um padrão regex.
+     * Similar à função preg_replace() do PHP.
+     *
+     * Suporta referências para grupos capturados no texto de substituição:
+     * - $0: Match completo
+     * - $1, $2, $10, ${1}, etc: Grupos numéricos
+     * - $name, ${name}: Grupos nomeados
+     *
+     * @param pattern      Padrão regex no formato /pattern/flags.
+     * @param subject      String onde serão feitas as substituições.
+     * @param replacement  String de substituição (pode conter $0, $1, $name etc).
+     * @param offset       (Opcional) Posição onde iniciar as substituições (default: 0).
+     * @param limit        (Opcional) Limite máximo de substituições a serem realizadas (default: ilimitado).
+     * @return std::string Nova string com as substituições realizadas.
+     * @throws std::invalid_argument Se o padrão regex estiver malformado.
+     * @throws std::runtime_error Se houver erro na compilação do padrão.
+     */
+    std::string preg_replace( const std::string& pattern, const std::string& subject, const std::string& replacement, PCRE2_SIZE offset, std::size_t limit ) {
+
+        if(subject.empty() || limit == 0) return subject;
+
+        return forcaRegex::preg_replace( forcaRegex::getPattern(pattern), subject, replacement, offset, limit );
+
+    }
+
+    /**
+     * Divide uma string em substrings usando um padrão regex como delimitador, sem copiar os pedaços.
+     * As views apontam para o subject, que precisa continuar vivo enquanto elas forem usadas.
+     *
+     * @param pattern  Padrão já compilado usado como delimitador.
+     * @param subject  String a ser dividida.
+     * @param limit    (Opcional) Quantidade máxima de pedaços, o último contém o restante da string (default: ilimitado).
+     * @return std::vector<std::string_view> Vetor contendo as views dos pedaços.
+     */
+    std::vector<std::string_view> preg_split_view( const std::shared_ptr<const forcaRegex::RegexPattern>& pattern, const std::string& subject, std::size_t limit ) {
+
+        std::string_view view(subject);
+
+        if(subject.empty() || limit <= 1) return std::vector<std::string_view>{view};
+
+        // O último pedaço é sempre o restante da string, então bastam limit - 1 delimitadores.
+        forcaRegex::RegexMatches result = forcaRegex::preg_match_all_offsets(pattern, subject, 0, limit - 1);
+
+        if (!result.match) return std::vector<std::string_view>{view};
+
+        std::size_t i, matchesLength = result.size();
+
+        std::vector<std::string_view> explode;
+
+        explode.reserve(matchesLength + 1);
+
+        std::string::size_type offset = 0;
+
+        for(i=0; i<matchesLength; i++){
+
+            std::string::size_type start = result.start(0, i);
+
+            // Matches vazios logo após o delimitador anterior (ou antes do início) não geram pedaços novos.
+            if(start < offset) continue;
+
+            explode.push_back( view.substr( offset, start - offset ) );
+
+            offset = result.end(0, i);
+
+        }
+
+        explode.push_back( view.substr(offset) );
+
+        return explode;
+
+    }
+
+    /**
+     * Divide uma string em substrings usando um padrão regex como delimitador, sem copiar os pedaços.
+     * As views apontam para o subject, que precisa continuar vivo enquanto elas forem usadas.
+     *
+     * @param pattern  Padrão regex usado como delimitador, no formato /pattern/flags.
+     * @param subject  String a ser dividida.
+     * @param limit    (Opcional) Quantidade máxima de pedaços, o último contém o restante da string (default: ilimitado).
+     * @return std::vector<std::string_view> Vetor contendo as views dos pedaços.
+     * @throws std::invalid_argument Se o padrão regex estiver malformado.
+     * @throws std::runtime_error Se houver erro na compilação do padrão.
+     */
+    std::vector<std::string_view> preg_split_view( const std::string& pattern, const std::string& subject, std::size_t limit ) {
+
+        if(subject.empty() || limit <= 1) return std::vector<std::string_view>{ std::string_view(subject) };
+
+        return forcaRegex::preg_split_view( forcaRegex::getPattern(pattern), subject, limit );
+
+    }
+
+    /**
+     * Igual ao preg_split(), usando um padrão já compilado (ex: StaticPattern).
+     */
+    std::vector<std::string> preg_split( const std::shared_ptr<const forcaRegex::RegexPattern>& pattern, const std::string& subject, std::size_t limit ) {
+
+        std::vector<std::string_view> views = forcaRegex::preg_split_view(pattern, subject, limit);
+
+        return std::vector<std::string>( views.begin(), views.end() );
+
+    }
+
+    /**
+     * Divide uma string em substrings usando um padrão regex como delimitador.
+     * Similar à função preg_split() do PHP.
+     *
+     * @param pattern  Padrão regex usado como delimitador.
+     * @param subject  String a ser dividida.
+     * @param limit    (Opcional) Quantidade máxima de pedaços, o último contém o restante da string (default: ilimitado).
+     * @return std::vector<std::string> Vetor contendo as substrings resultantes.
+     */
+    std::vector<std::string> preg_split( const std::string& pattern, const std::string& subject, std::size_t limit ) {
+
+        std::vector<std::string_view> views = forcaRegex::preg_split_view(pattern, subject, limit);
+
+        return std::vector<std::string>( views.begin(), views.end() );
+
+    }
+
+
+    /**
+     * Verifica se uma expressão pode ser colocada dentro do programa combinado do RegexSet.
+     * Expressões que usam a numeração/nomes dos grupos (backreferences, recursão, subrotinas),
+     * verbos como (*UTF) ou (*COMMIT), que afetam o programa inteiro, callouts próprios, que se
+     * confundiriam com os callouts do conjunto, e \Q, que sem \E engoliria o resto do programa,
+     * precisam rodar sozinhas. A verificação é conservadora: na dúvida, o padrão roda separado (com o mesmo resultado).
+     * 
+     * @param   const std::string& expression    Expressão regular, sem delimitadores e flags
+     * @return  bool                             true se a expressão puder ser combinada
+     */
+    static bool canCombine( const std::string& expression ) {
+
+        std::size_t i, length = expression.length();
+
+        for( i = 0; i + 1 < length; i++ ){
+
+            char c = expression[i], next = expression[i + 1];
+
+            if( c == '(' && next == '*' ) return false;
+
+            if( c == '\\' ){
+
+                if( ( next >= '1' && next <= '9' ) || next == 'g' || next == 'k' || next == 'Q' ) return false;
+
+                i++; // Pula o caractere escapado.
+
+                continue;
+
+            }
+
+            if( c == '(' && next == '?' && i + 2 < length ){
+
+                char kind = expression[i + 2];
+
+                if( kind == 'R' || kind == '&' || kind == '+' || kind == '-' || kind == 'C' || ( kind >= '0' && kind <= '9' ) ) return false;
+
+                // (?P=name) e (?P>name)
+                if( kind == 'P' && i + 3 < length && ( expression[i + 3] == '=' || expression[i + 3] == '>' ) ) return false;
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+    /**
+     * Estado compartilhado com o callout durante o match de um RegexSet.
+     */
+    struct RegexSetState {
+
+        std::vector<forcaRegex::RegexSetMatch> *results;
+
+        const std::vector<std::size_t> *index;
+
+        std::size_t remaining;
+
+    };
+
+    /**
+     * Callout chamado no fim de cada alternativa do programa combinado.
+     * Registra o primeiro match de cada padrão e interrompe a busca quando todos tiverem match.
+     */
+    static int regexSetCallout( pcre2_callout_block* block, void* data ) {
+
+        forcaRegex::RegexSetState *state = static_cast<forcaRegex::RegexSetState*>(data);
+
+        // Callouts numéricos ou de texto que não são do RegexSet (ex: do próprio padrão) são ignorados.
+        if( block->callout_string == nullptr || block->callout_string_length == 0 ) return 0;
+
+        std::size_t alternative = 0;
+
+        for( PCRE2_SIZE i = 0; i < block->callout_string_length; i++ ){
+
+            PCRE2_UCHAR c = block->callout_string[i];
+
+            if( c < '0' || c > '9' ) return 0;
+
+            alternative = alternative * 10 + ( c - '0' );
+
+        }
+
+        if( alternative >= state->index->size() ) return 0;
+
+        forcaRegex::RegexSetMatch& result = (*state->results)[ (*state->index)[alternative] ];
+
+        if( !result.match ){
+
+            result.match = true;
+            result.start = block->start_match;
+            result.end = block->current_position;
+
+            state->remaining--;
+
+            // Todos os padrões já tiveram match, não precisa continuar a busca.
+            if( state->remaining == 0 ) return PCRE2_ERROR_CALLOUT;
+
+        }
+
+        return 0;
+
+    }
+
+    /**
+     * Cria o conjunto, combinando os padrões em até dois programas: um para os padrões sem a flag u e outro
+     * para os padrões com a flag u. Assim o modo UTF de um padrão não muda como os outros casam (ex: "." em bytes).
+     * Cada padrão é compilado sozinho antes (e fica no cache), garantindo os mesmos erros do preg_match()
+     * e que nenhum padrão inválido altere a estrutura do programa combinado.
+     * 
+     * @param   const std::vector<std::string>& patterns    Padrões no formato /pattern/flags
+     * @throws  std::invalid_argument                       Se algum padrão estiver malformado
+     * @throws  std::runtime_error                          Se houver erro na compilação de algum padrão
+     */
+    RegexSet::RegexSet( const std::vector<std::string>& patterns ) : count( patterns.size() ) {
+
+        // Índice 0: padrões sem a flag u. Índice 1: padrões com a flag u.
+        std::string expressions[2] = { "(?J)(?:", "(?J)(?:" };
+
+        std::vector<std::size_t> combinable[2];
+
+        std::vector< std::shared_ptr<const forcaRegex::RegexPattern> > compiled( count );
+
+        for( std::size_t i = 0; i < count; i++ ){
+
+            compiled[i] = forcaRegex::getPattern(patterns[i]);
+
+            const forcaRegex::RegexPattern& parsed = *compiled[i];
+
+            if( !forcaRegex::canCombine(parsed.expression) ){
+
+                separate.emplace_back( i, compiled[i] );
+
+                continue;
+
+            }
+
+            std::string flags;
+
+            if( parsed.options & PCRE2_CASELESS ) flags += 'i';
+            if( parsed.options & PCRE2_MULTILINE ) flags += 'm';
+            if( parsed.options & PCRE2_DOTALL ) flags += 's';
+            if( parsed.options & PCRE2_EXTENDED ) flags += 'x';
+            if( parsed.options & PCRE2_UNGREEDY ) flags += 'U';
+
+            int mode = ( parsed.options & PCRE2_UTF ) ? 1 : 0;
+
+            std::string& expression = expressions[mode];
+
+            if( !combinable[mode].empty() ) expression += '|';
+
+            // O "^" desliga as flags herdadas, assim cada alternativa usa somente as flags do seu padrão.
+            expression += "(?^" + flags + ":" + parsed.expression;
+
+            // No modo x um comentário (#) iria até o fim da linha e engoliria o resto do programa.
+            if( parsed.options & PCRE2_EXTENDED ) expression += '\n';
+
+            expression += ")(?C'" + std::to_string( combinable[mode].size() ) + "')";
+
+            combinable[mode].push_back(i);
+
+        }
+
+        for( int mode = 0; mode < 2; mode++ ){
+
+            if( combinable[mode].empty() ) continue;
+
+            std::string combinedPattern = "/" + expressions[mode] + ")(*F)/" + ( mode == 1 ? "u" : "" );
+
+            try {
+
+                CombinedProgram program{ forcaRegex::getPattern(combinedPattern), combinable[mode], {} };
+
+                for( std::size_t i : combinable[mode] ) program.patterns.push_back( compiled[i] );
+
+                combined.push_back( std::move(program) );
+
+            } catch (const std::runtime_error&) {
+
+                // Os padrões compilam sozinhos, mas não juntos (ex: limites de compilação): rodam separados.
+                for( std::size_t i : combinable[mode] ) separate.emplace_back( i, compiled[i] );
+
+            }
+
+        }
+
+        std::sort( separate.begin(), separate.end(), []( const auto& a, const auto& b ){ return a.first < b.first; } );
+
+    }
+
+    /**
+     * Executa um único padrão do conjunto com preg_match_offsets() e registra o primeiro match no resultado.
+     */
+    static void matchSingle( forcaRegex::RegexSetMatch& result, const std::shared_ptr<const forcaRegex::RegexPattern>& pattern, const std::string& subject, PCRE2_SIZE offset ) {
+
+        forcaRegex::RegexMatches single = forcaRegex::preg_match_offsets(pattern, subject, offset);
+
+        if( single.match ){
+
+            result.match = true;
+            result.start = single.start(0);
+            result.end = single.end(0);
+
+        }
+
+    }
+
+    /**
+     * Testa o subject contra todos os padrões do conjunto.
+     * Assim como no preg_match(), um subject vazio ou um offset fora da string não tem match.
+     * 
+     * @param   const std::string& subject    String onde será feita a busca
+     * @param   PCRE2_SIZE offset             Posição onde iniciar a busca (default: 0)
+     * @return  std::vector<RegexSetMatch>    Um resultado por padrão, na mesma ordem dos padrões
+     * @throws  RegexLimitError               Se algum padrão, executado sozinho, estourar os limites de execução
+     */
+    std::vector<forcaRegex::RegexSetMatch> RegexSet::match( const std::string& subject, PCRE2_SIZE offset ) const {
+
+        std::vector<forcaRegex::RegexSetMatch> results(count);
+
+        if( subject.empty() || offset >= subject.length() ) return results;
+
+        for( const CombinedProgram& program : combined ){
+
+            forcaRegex::RegexThreadContext& context = forcaRegex::threadContext();
+
+            if( context.mcontext == nullptr ) throw std::bad_alloc();
+
+            forcaRegex::RegexSetState state{ &results, &program.index, program.index.size() };
+
+            // Remove o callout do match context mesmo se o match lançar uma exceção.
+            struct CalloutGuard {
+
+                pcre2_match_context *mcontext;
+
+                ~CalloutGuard() { pcre2_set_callout(mcontext, nullptr, nullptr); }
+
+            } guard{ context.mcontext };
+
+            pcre2_set_callout( context.mcontext, forcaRegex::regexSetCallout, &state );
+
+            pcre2_match_data *match_data = context.matchData(*program.pattern);
+
+            int result;
+
+            try {
+
+                // O programa nunca tem match (*F): o retorno esperado é PCRE2_ERROR_NOMATCH ou PCRE2_ERROR_CALLOUT.
+                result = forcaRegex::executeMatch( *program.pattern, subject, offset, match_data );
+
+            } catch (const forcaRegex::RegexLimitError& e) {
+
+                /*
+                    O (*F) força o backtracking completo de todas as alternativas e o programa combinado perde as otimizações
+                    de cada padrão (caractere inicial, caractere obrigatório), então ele pode estourar limites que os padrões
+                    sozinhos não estouram. Ex: "/(a|aa)+b/" em uma sequência longa de "a".
+                */
+                result = e.code;
+
+            }
+
+            if( result == PCRE2_ERROR_NOMATCH || result == PCRE2_ERROR_CALLOUT ) continue;
+
+            // Os padrões rodam sozinhos, sem o callout do conjunto.
+            pcre2_set_callout( context.mcontext, nullptr, nullptr );
+
+            /*
+                Qualquer outro retorno (ex: UTF-8 inválido no subject ou limite de execução estourado) é um erro da busca
+                combinada, e não "nenhum match". Os padrões desse programa são executados um a um, com o mesmo resultado
+                (ou exceção) do preg_match().
+            */
+            for( std::size_t i = 0; i < program.index.size(); i++ ){
+
+                results[ program.index[i] ] = forcaRegex::RegexSetMatch();
+
+                forcaRegex::matchSingle( results[ program.index[i] ], program.patterns[i], subject, offset );
+
+            }
+
+        }
+
+        for( const auto& item : separate ){
+
+            forcaRegex::matchSingle( results[item.first], item.second, subject, offset );
+
+        }
+
+        return results;
 
     }
 
-}
\ No newline at end of file
+}
@@ -1,22 +1,135 @@
 #include <cstring>
+#if defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+    #define FORCA_STRINGS_SSE2 1
+    #include <emmintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+#endif
 #include <string>
 #include <vector>
 #include <iostream>
 #include <memory>
+#include <utility>
+#include <algorithm>
 #include <stdexcept>
+#include <thread>
+#include <system_error>
 #include <unicode/unistr.h>
 #include <unicode/brkiter.h>
 #include <unicode/ustream.h>
 #include <unicode/uchar.h>
+#include <unicode/uscript.h>
+#include <unicode/ucasemap.h>
 #include <unicode/locid.h>
+#include <unicode/coll.h>
 #include <unicode/normalizer2.h>
+#include <unicode/bytestream.h>
 #include <unicode/utf8.h>
+#include <unicode/utext.h>
 #include "forcaStrings.h"
 #include "forcaRegex.h"
+#include "forcaRegexBuiltins.h"
 #include "forcaUtils.h"
 
 namespace forcaStrings {
 
+    /* 
+    |=========================================
+    |   FUNÇÕES AUXILIARES ASCII
+    |========================================= 
+    */
+
+    /**
+     * Verifica se a string é composta apenas por bytes ASCII (0x00 a 0x7F).
+     *
+     * Strings puramente ASCII não precisam passar pela ICU: cada byte é um caractere, e mapeamento de caixa
+     * e remoção de espaços podem ser feitos diretamente sobre os bytes. A verificação usa SSE2 quando disponível,
+     * acumulando 64 bytes por iteração e testando o bit mais alto de cada byte com movemask.
+     *
+     * @param string String a ser verificada.
+     * @return bool true se todos os bytes forem ASCII.
+     */
+    bool isASCII( std::string_view string ) {
+
+        const unsigned char* data = reinterpret_cast<const unsigned char*>( string.data() );
+
+        std::size_t length = string.length();
+
+        std::size_t i = 0;
+
+#ifdef FORCA_STRINGS_SSE2
+
+        for(; i + 64 <= length; i += 64){
+
+            __m128i block = _mm_or_si128(
+                _mm_or_si128( _mm_loadu_si128( reinterpret_cast<const __m128i*>(data + i) ), _mm_loadu_si128( reinterpret_cast<const __m128i*>(data + i + 16) ) ),
+                _mm_or_si128( _mm_loadu_si128( reinterpret_cast<const __m128i*>(data + i + 32) ), _mm_loadu_si128( reinterpret_cast<const __m128i*>(data + i + 48) ) )
+            );
+
+            if( _mm_movemask_epi8(block) != 0 ) return false;
+
+        }
+
+        for(; i + 16 <= length; i += 16){
+
+            if( _mm_movemask_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>(data + i) ) ) != 0 ) return false;
+
+        }
+
+#endif
+
+        unsigned char bits = 0;
+
+        for(; i < length; i++) bits |= data[i];
+
+        return bits < 0x80;
+
+    }
+
+    /**
+     * Verifica se o byte é um espaço em branco ASCII segundo a propriedade Unicode White_Space,
+     * ou seja, o mesmo conjunto que u_isUWhiteSpace reconhece abaixo de 0x80: \t, \n, \v, \f, \r e espaço.
+     *
+     * @param c Byte a ser verificado.
+     * @return bool true se for espaço em branco.
+     */
+    static inline bool isASCIIWhiteSpace( unsigned char c ) {
+
+        return c == ' ' || ( c >= '\t' && c <= '\r' );
+
+    }
+
+    /**
+     * Verifica se o byte é uma letra ASCII (A-Z, a-z), independente do locale do processo.
+     *
+     * @param c Byte a ser verificado.
+     * @return bool true se for letra ASCII.
+     */
+    static inline bool isASCIILetter( unsigned char c ) {
+
+        return static_cast<unsigned char>( (c | 0x20) - 'a' ) < 26;
+
+    }
+
+    /**
+     * Converte a caixa das letras ASCII de uma string no próprio buffer.
+     *
+     * @param text  String ASCII a ser convertida.
+     * @param upper true para maiúsculas, false para minúsculas.
+     */
+    static void asciiCaseMap( std::string& text, bool upper ) {
+
+        const unsigned char first = upper ? 'a' : 'A';
+
+        for(char& c : text){
+
+            if( static_cast<unsigned char>( static_cast<unsigned char>(c) - first ) < 26 ) c ^= 0x20;
+
+        }
+
+    }
+
     /* 
     |=========================================
     |   FUNÇÕES DE NORMALIZAÇÃO DE STRING
@@ -26,56 +139,72 @@ namespace forcaStrings {
     /**
      * Remove os espaçamentos da string obtida, considerendo caracteres unicode.
      *
+     * A string é percorrida uma única vez direto em UTF-8: bytes ASCII são classificados diretamente e os demais
+     * code points são decodificados com U8_NEXT e classificados com u_isUWhiteSpace. Os bytes que não são espaço
+     * são copiados para uma saída já alocada com o tamanho da entrada. Sequências UTF-8 inválidas são mantidas como estão.
+     *
      * @param   std::string text    String que terá seus espaços removidos
      * @return  std::string         String normalizada sem espaços
      */
     std::string removeSpaces( const std::string& string ) {
 
-        std::string text = string;
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>( string.data() );
+
+        std::size_t length = string.length();
 
-        icu::UnicodeString input(text.c_str(), "UTF-8");
+        std::string response;
+
+        response.resize(length);
+
+        char* output = &response[0];
+
+        std::size_t written = 0;
 
-        int32_t i = 0;
+        std::size_t i = 0;
 
-        while (i < input.length()) {
+        while( i < length ){
 
-            UChar32 c = input.char32At(i);
+            if( bytes[i] < 0x80 ){
 
-            if (u_isUWhiteSpace(c)) {
+                if( ! isASCIIWhiteSpace(bytes[i]) ) output[written++] = static_cast<char>(bytes[i]);
 
-                input.remove(i, U16_LENGTH(c));
+                i++;
+
+                continue;
 
-            } 
-            else {
-                i += U16_LENGTH(c);
             }
 
-        }
+            std::size_t start = i;
 
-        std::string response;
+            UChar32 c;
 
-        input.toUTF8String(response);
+            U8_NEXT(bytes, i, length, c);
+
+            if( c < 0 || ! u_isUWhiteSpace(c) ){
+
+                std::memcpy( output + written, bytes + start, i - start );
+
+                written += i - start;
+
+            }
+
+        }
+
+        response.resize(written);
 
         return response;
 
     }
 
     /**
-     * Normaliza uma string Unicode de acordo com a forma especificada.
-     *
-     * Esta função aplica a normalização Unicode na string de entrada, utilizando as formas NFC, NFD, NFKC ou NFKD,
-     * conforme especificado no parâmetro form. A normalização é útil para garantir que diferentes representações
-     * de caracteres Unicode equivalentes sejam convertidas para uma forma canônica comum.
-     *
-     * Inspirada na função normalize do JavaScript.
+     * Retorna a instância de Normalizer2 da ICU correspondente à forma de normalização informada.
      *
-     * @param string String a ser normalizada.
-     * @param form   Forma de normalização: "NFC", "NFD", "NFKC" ou "NFKD".
-     * @return std::string String normalizada conforme a forma especificada.
+     * @param form Forma de normalização: "NFC", "NFD", "NFKC" ou "NFKD".
+     * @return const icu::Normalizer2* Instância compartilhada da ICU (não deve ser liberada).
      * @throws std::invalid_argument Se a forma de normalização for inválida.
      * @throws std::runtime_error Em caso de erro na biblioteca ICU.
      */
-    std::string normalize( const std::string& string, const std::string& form ) {
+    static const icu::Normalizer2* getNormalizer( const std::string& form ) {
 
         UErrorCode status = U_ZERO_ERROR;
 
@@ -104,1019 +233,2981 @@ namespace forcaStrings {
             throw std::runtime_error("Normalize Error: " + std::string(u_errorName(status)));
         }
 
-        icu::UnicodeString input = icu::UnicodeString::fromUTF8(string);
-
-        icu::UnicodeString result = normalizer->normalize(input, status);
-
-        if (U_FAILURE(status)) {
-            throw std::runtime_error("Normalize Error: " + std::string(u_errorName(status)));
-        }
-
-        std::string response;
-
-        result.toUTF8String(response);
-        
-        return response;
+        return normalizer;
 
     }
 
     /**
-     * Remove acentos e caracteres especiais (ç) de uma string, substituindo-os 
-     * por seus equivalentes sem acentuação. Por exemplo, 'á' é substituído por 'a',
-     * 'ç' por 'c', etc. Focado em palavras pt-br.
+     * Normaliza um texto UTF-8 diretamente em UTF-8, sem passar por UnicodeString (UTF-16).
      *
-     * @param   std::string text    String que terá seus acentos removidos
-     * @return  std::string         String normalizada sem acentos
+     * Primeiro verifica com isNormalizedUTF8 se o texto já está na forma pedida; nesse caso nada é escrito
+     * e a função retorna false, permitindo ao chamador devolver a própria entrada. Caso contrário, o resultado
+     * é escrito em output por meio de um StringByteSink.
+     *
+     * @param normalizer Instância de Normalizer2 a ser usada.
+     * @param input      Texto UTF-8 de entrada.
+     * @param output     String que recebe o texto normalizado (apenas quando a função retorna true).
+     * @return bool true se o texto precisou ser normalizado, false se já estava normalizado.
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
      */
-    std::string removeAcentos( const std::string& string ) {
-
-        /**
-         * Palavras acentuadas e ç. Serão usadas para comparação e depois
-         * serão substituidas pela letra normal na função de normalização
-         * de strings.
-         * 
-         * @var	string _REMOVE_ACENTOS_ACENTUADAS_
-         */
-        static const std::string _REMOVE_ACENTOS_ACENTUADAS_[] = {
-            "á", "à", "â", "ã", "ä", "Á", "À", "Â", "Ã", "Ä",
-            "é", "è", "ê", "ë", "É", "È", "Ê", "Ë",
-            "í", "ì", "î", "ï", "Í", "Ì", "Î", "Ï",
-            "ó", "ò", "ô", "õ", "ö", "Ó", "Ò", "Ô", "Õ", "Ö",
-            "ú", "ù", "û", "ü", "Ú", "Ù", "Û", "Ü",
-            "ç", "Ç"
-        };
-
-        /**
-         * Palavras normais, sem acentuação e ç. Serão usadas para substituição,
-         * na função de normalização de strings.
-         * 
-         * @var string _REMOVE_ACENTOS_NORMALIZADAS_
-         */
-        static const std::string _REMOVE_ACENTOS_NORMALIZADAS_[] = {
-            "a", "a", "a", "a", "a", "A", "A", "A", "A", "A",
-            "e", "e", "e", "e", "E", "E", "E", "E",
-            "i", "i", "i", "i", "I", "I", "I", "I",
-            "o", "o", "o", "o", "o", "O", "O", "O", "O", "O",
-            "u", "u", "u", "u", "U", "U", "U", "U",
-            "c", "C"
-        };
+    static bool normalizeUTF8( const icu::Normalizer2* normalizer, const std::string& input, std::string& output ) {
 
-        /**
-         * Cache do tamanho da string constante ACENTUADOS. Evita ficar recalculando
-         * desnecessáriamente o tamanho a acada função.
-         * 
-         * @var	int	_REMOVE_ACENTOS_MAP_SIZE_
-         */
-        static const int _REMOVE_ACENTOS_MAP_SIZE_ =
-            sizeof(_REMOVE_ACENTOS_ACENTUADAS_) / sizeof(_REMOVE_ACENTOS_ACENTUADAS_[0]);
-
-        std::string text = forcaStrings::normalize(string, "NFC");
-
-        int i;
-        std::string::size_type pos;
-        std::string::size_type stringSize;        
+        UErrorCode status = U_ZERO_ERROR;
 
-        for(i = 0; i < _REMOVE_ACENTOS_MAP_SIZE_; i++) {
+        if( normalizer->isNormalizedUTF8(input, status) ) return false;
 
-            stringSize = _REMOVE_ACENTOS_ACENTUADAS_[i].size();
-            pos = text.find(_REMOVE_ACENTOS_ACENTUADAS_[i]);
+        if (U_FAILURE(status)) {
+            throw std::runtime_error("Normalize Error: " + std::string(u_errorName(status)));
+        }
 
-            while(pos != std::string::npos) {
+        icu::StringByteSink<std::string> sink( &output, static_cast<int32_t>( input.length() ) );
 
-                text.replace(pos, stringSize, _REMOVE_ACENTOS_NORMALIZADAS_[i]);
-                pos = text.find(_REMOVE_ACENTOS_ACENTUADAS_[i], pos);
-            
-            }
+        normalizer->normalizeUTF8(0, input, sink, nullptr, status);
 
+        if (U_FAILURE(status)) {
+            throw std::runtime_error("Normalize Error: " + std::string(u_errorName(status)));
         }
 
-        return text;
+        return true;
 
     }
 
     /**
-     * Converte todos os caracteres de uma string para maiúsculos. A função lida 
-     * corretamente com caracteres Unicode.
+     * Normaliza uma string Unicode de acordo com a forma especificada.
      *
-     * @param   std::string text    String que será convertida para maiúsculo
-     * @return  std::string         String com todos os caracteres em maiúsculo
+     * Esta função aplica a normalização Unicode na string de entrada, utilizando as formas NFC, NFD, NFKC ou NFKD,
+     * conforme especificado no parâmetro form. A normalização é útil para garantir que diferentes representações
+     * de caracteres Unicode equivalentes sejam convertidas para uma forma canônica comum.
+     *
+     * A normalização é feita direto em UTF-8 (Normalizer2::normalizeUTF8). Se a string já estiver na forma pedida,
+     * ela é devolvida sem nenhuma conversão.
+     *
+     * Inspirada na função normalize do JavaScript.
+     *
+     * @param string String a ser normalizada.
+     * @param form   Forma de normalização: "NFC", "NFD", "NFKC" ou "NFKD".
+     * @return std::string String normalizada conforme a forma especificada.
+     * @throws std::invalid_argument Se a forma de normalização for inválida.
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
      */
-    std::string to_uppercase( const std::string& string ) {
-        
-        std::string text = string;
-
-        icu::UnicodeString input(text.c_str(), "UTF-8");
-
-        input.toUpper(icu::Locale::getDefault());
+    std::string normalize( const std::string& string, const std::string& form ) {
 
         std::string response;
 
-        input.toUTF8String(response);
-
+        if( ! normalizeUTF8( getNormalizer(form), string, response ) ) return string;
+        
         return response;
 
     }
 
     /**
-     * Converte todos os caracteres de uma string para minúsculos. A função lida 
-     * corretamente com caracteres Unicode.
+     * Normaliza uma string Unicode de acordo com a forma especificada, reaproveitando a string recebida.
      *
-     * @param   std::string text    String que será convertida para minúsculo
-     * @return  std::string         String com todos os caracteres em minúsculo
+     * Igual à versão por referência constante, mas quando a string já está normalizada o próprio buffer
+     * é movido para o retorno, sem nenhuma alocação nova. Útil para textos grandes, como conteúdos de arquivos.
+     *
+     * @param string String a ser normalizada (movida para o retorno quando já estiver normalizada).
+     * @param form   Forma de normalização: "NFC", "NFD", "NFKC" ou "NFKD".
+     * @return std::string String normalizada conforme a forma especificada.
+     * @throws std::invalid_argument Se a forma de normalização for inválida.
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
      */
-    std::string to_lowercase( const std::string& string ) {
-
-        std::string text = string;
-
-        icu::UnicodeString input(text.c_str(), "UTF-8");
-
-        input.toLower(icu::Locale::getDefault());
+    std::string normalize( std::string&& string, const std::string& form ) {
 
         std::string response;
 
-        input.toUTF8String(response);
-
+        if( ! normalizeUTF8( getNormalizer(form), string, response ) ) return std::move(string);
+        
         return response;
 
     }
 
     /**
-     * Remove espaços em branco do início e do fim de uma string.
-     * Combina as funcionalidades de ltrim() e rtrim() em uma única chamada.
-     * 
-     * Inspirado na função PHP trim().
-     * 
-     * @param   const std::string& string    String que terá os espaços removidos
-     * @return  std::string                  String sem espaços no início e fim
+     * Tabela de remoção de acentos para os blocos latinos do Unicode: Latin-1 Supplement e Latin Extended-A/B
+     * (U+00C0 a U+024F) e Latin Extended Additional (U+1E00 a U+1EFF).
+     *
+     * Cada posição guarda a letra ASCII base do code point, ou 0 quando ele deve ser mantido como está
+     * (por exemplo ×, Æ, ß). A tabela é montada uma única vez a partir da decomposição canônica (NFD) da ICU:
+     * se a decomposição é uma letra ASCII seguida apenas de marcas combinantes, o code point vira essa letra.
+     * Letras com traço ou barra, que não possuem decomposição (ø, đ, ł...), são completadas manualmente.
      */
-    std::string trim( const std::string& string ) {
+    struct LatinFoldTable {
 
-        std::string text = string;
+        static constexpr UChar32 LATIN_START = 0x00C0;
 
-        icu::UnicodeString input(text.c_str(), "UTF-8");
+        static constexpr UChar32 LATIN_END = 0x0250;
 
-        UChar32 c = input.char32At(0);
+        static constexpr UChar32 ADDITIONAL_START = 0x1E00;
 
-        while( u_isUWhiteSpace(c) && input.length() != 0){
+        static constexpr UChar32 ADDITIONAL_END = 0x1F00;
 
-            input.remove(0, U16_LENGTH(c));   
-            
-            c = input.char32At(0);
+        unsigned char latin[LATIN_END - LATIN_START] = {};
 
-        }
+        unsigned char additional[ADDITIONAL_END - ADDITIONAL_START] = {};
 
-        c = input.char32At(input.length() - 1);
+        unsigned char fold( UChar32 c ) const {
 
-        while( u_isUWhiteSpace(c) && input.length() != 0){
+            if( c >= LATIN_START && c < LATIN_END ) return latin[c - LATIN_START];
 
-            input.remove( (input.length() - 1), U16_LENGTH(c) );
+            if( c >= ADDITIONAL_START && c < ADDITIONAL_END ) return additional[c - ADDITIONAL_START];
 
-            c = input.char32At(input.length() - 1);
+            return 0;
 
         }
 
-        std::string response;
-
-        input.toUTF8String(response);
-
-        return response;
-
-    }
+    };
 
     /**
-     * Remove espaços em branco do início de uma string (left trim).
-     * Remove espaços, tabs, quebras de linha e outros caracteres de espaçamento
-     * do início da string.
-     * 
-     * Inspirado na função PHP ltrim().
-     * 
-     * @param   const std::string& string    String que terá os espaços removidos do início
-     * @return  std::string                  String sem espaços no início
+     * Retorna a tabela de remoção de acentos dos blocos latinos, montando-a na primeira chamada.
+     *
+     * @return const LatinFoldTable& Tabela compartilhada (a inicialização de estáticos locais é thread-safe).
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
      */
-    std::string ltrim( const std::string& string ) {
-
-        std::string text = string;
+    static const LatinFoldTable& latinFoldTable() {
 
-        icu::UnicodeString input(text.c_str(), "UTF-8");
+        static const LatinFoldTable table = []() {
 
-        UChar32 c = input.char32At(0);
+            UErrorCode status = U_ZERO_ERROR;
 
-        while( u_isUWhiteSpace(c) && input.length() != 0){
+            const icu::Normalizer2* nfd = icu::Normalizer2::getNFDInstance(status);
 
-            input.remove(0, U16_LENGTH(c));   
-            
-            c = input.char32At(0);
+            if( U_FAILURE(status) ) throw std::runtime_error("ICU Erro: " + std::string(u_errorName(status)));
 
-        }
+            LatinFoldTable folds;
 
-        std::string response;
+            auto build = [nfd]( unsigned char* entries, UChar32 first, UChar32 last ) {
 
-        input.toUTF8String(response);
+                icu::UnicodeString decomposition;
 
-        return response;
+                UChar32 c;
 
-    }
+                for(c = first; c < last; c++){
 
-    /**
-     * Remove espaços em branco do fim de uma string (right trim).
-     * Remove espaços, tabs, quebras de linha e outros caracteres de espaçamento
-     * do final da string.
-     * 
-     * Inspirado na função PHP rtrim().
-     * 
-     * @param   const std::string& string    String que terá os espaços removidos do fim
-     * @return  std::string                  String sem espaços no fim
-     */
-    std::string rtrim( const std::string& string ) {
+                    if( ! nfd->getDecomposition(c, decomposition) ) continue;
 
-        std::string text = string;
+                    UChar32 base = decomposition.char32At(0);
 
-        icu::UnicodeString input(text.c_str(), "UTF-8");
+                    if( base >= 0x80 || ! u_isalpha(base) ) continue;
 
-        UChar32 c = input.char32At( (input.length() - 1) );
+                    int32_t i;
 
-        while( u_isUWhiteSpace(c) && input.length() != 0){
+                    bool marks = true;
 
-            input.remove( (input.length() - 1), U16_LENGTH(c) );
+                    for(i = U16_LENGTH(base); i < decomposition.length(); i += U16_LENGTH( decomposition.char32At(i) )){
 
-            c = input.char32At(input.length() - 1);
+                        if( u_getCombiningClass( decomposition.char32At(i) ) == 0 ) marks = false;
 
-        }
+                    }
 
-        std::string response;
+                    if(marks) entries[c - first] = static_cast<unsigned char>(base);
 
-        input.toUTF8String(response);
+                }
 
-        return response;
+            };
 
-    }
+            build( folds.latin, LatinFoldTable::LATIN_START, LatinFoldTable::LATIN_END );
 
-    /**
-     * Normaliza uma string removendo espaços, acentos e convertendo para maiúsculo.
-     * Esta função combina as operações de removeSpaces(), removeAcentos() e 
-     * to_uppercase() em uma única chamada.
-     *
-     * @param   std::string text    String que será normalizada
-     * @return  std::string         String normalizada sem espaços, acentos e em maiúsculo
-     */
-    std::string normalizeWord( const std::string& string ) {
+            build( folds.additional, LatinFoldTable::ADDITIONAL_START, LatinFoldTable::ADDITIONAL_END );
 
-        std::string text = string;
+            /*
+                Letras com traço, barra ou gancho que não têm decomposição canônica, mas que para o jogo
+                também são consideradas acentuadas.
+            */
+            static const std::pair<UChar32, char> STROKES[] = {
+                {0x00D8, 'O'}, {0x00F8, 'o'}, {0x0110, 'D'}, {0x0111, 'd'}, {0x0126, 'H'}, {0x0127, 'h'},
+                {0x0131, 'i'}, {0x0141, 'L'}, {0x0142, 'l'}, {0x0166, 'T'}, {0x0167, 't'}, {0x0180, 'b'},
+                {0x0197, 'I'}, {0x01B5, 'Z'}, {0x01B6, 'z'}, {0x01E4, 'G'}, {0x01E5, 'g'}
+            };
 
-        text = forcaStrings::removeSpaces(text);
+            for(const auto& stroke : STROKES) folds.latin[stroke.first - LatinFoldTable::LATIN_START] = static_cast<unsigned char>(stroke.second);
 
-        text = forcaStrings::removeAcentos(text);
+            return folds;
 
-        text = forcaStrings::to_uppercase(text);
+        }();
 
-        return text;
+        return table;
 
     }
 
     /**
-     * Normaliza quebras de linha em uma string, convertendo diferentes tipos de quebra
-     * para o formato Unix (\n).
-     * 
-     * Converte as seguintes sequências para \n:
-     * - \r\n (Windows)
-     * - \v (Vertical tab)
-     * - \f (Form feed)
-     * - \n (Unix)
+     * Verifica se um code point fora do ASCII, mantido na saída de removeAcentos(), é uma letra latina.
+     * Marcas combinantes só são descartadas quando seguem uma letra latina.
      *
-     * @param   const std::string& text    String que terá as quebras de linha normalizadas
-     * @return  std::string               String com quebras de linha normalizadas para \n
+     * @param c Code point (>= 0x80).
+     * @return bool true se o code point for da escrita latina.
      */
-    std::string normalizeLineBreaks( const std::string& text ) {
+    static bool isLatinBase( UChar32 c ) {
+
+        UErrorCode status = U_ZERO_ERROR;
 
-        return forcaRegex::preg_replace(R"(/(?:\r\n|\r|\n|\v|\f|\x85|\x0b|\p{Zl}|\p{Zp})/u)", text, "\n");
+        return uscript_getScript(c, &status) == USCRIPT_LATIN && U_SUCCESS(status);
 
     }
 
     /**
-     * Remove quebras de linha múltiplas consecutivas, substituindo-as por uma única quebra.
-     * 
-     * Por exemplo:
-     * "texto\n\n\n\ntexto" se torna "texto\ntexto"
+     * Remove acentos e caracteres especiais (ç) de uma string, substituindo-os 
+     * por seus equivalentes sem acentuação. Por exemplo, 'á' é substituído por 'a',
+     * 'ç' por 'c', etc. Cobre todas as letras acentuadas dos blocos latinos.
      *
-     * @param   const std::string& text    String que terá as quebras de linha extras removidas
-     * @return  std::string               String com apenas quebras de linha simples
+     * A string é percorrida uma única vez em UTF-8: letras latinas precompostas passam pela LatinFoldTable,
+     * marcas combinantes (U+0300 a U+036F) que seguem uma letra latina em texto decomposto são descartadas e o restante
+     * é copiado direto para a saída. Marcas sobre letras de outras escritas (ex: cirílico "и" + U+0306) são mantidas
+     * e recompostas pela normalização NFC, então o resultado não depende da forma de normalização da entrada. Só quando sobra algum caractere não latino fora da forma NFC o resultado é normalizado,
+     * preservando o comportamento anterior, que normalizava a string inteira para NFC.
+     *
+     * @param   std::string text    String que terá seus acentos removidos
+     * @return  std::string         String normalizada sem acentos
      */
-    std::string removeExtraLineBreaks( const std::string& text, bool normalize ) {
+    std::string removeAcentos( const std::string& string ) {
 
-        if(normalize){
-            return forcaRegex::preg_replace(R"(/(?:\r\n|\r|\n|\v|\f|\x85|\x0b|\p{Zl}|\p{Zp})+/u)", text, "\n");
-        }
-        else{
-            return forcaRegex::preg_replace(R"(/((?:\r\n|\r|\n|\v|\f|\x85|\x0b|\p{Zl}|\p{Zp}))+/u)", text, "$1");
-        }
+        const LatinFoldTable& table = latinFoldTable();
 
-    }
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>( string.data() );
 
-    /*
-    |=============================
-    |   FUNÇÕES DE VERIFICAÇÃO
-    |=============================
-    */
+        std::size_t length = string.length();
 
-    /**
-     * Verifica se uma string contém apenas caracteres alfabéticos (A-Z, a-z).
-     *
-     * Percorre cada caractere da string e retorna false caso encontre algum caractere
-     * que não seja uma letra. Caso todos os caracteres sejam letras, retorna true.
-     *
-     * @param   std::string word    String a ser verificada.
-     * @return  bool                true se todos os caracteres são letras, false caso contrário.
-     */
-    bool checkAlphaCharacters( const std::string& word ) {
+        std::string response;
 
-        std::string::size_type length = word.length();
+        response.reserve(length);
 
-        std::string::size_type i;
+        bool kept = false;
 
-        for (i = 0; i<length; i++) {
+        // Indica se o último caractere (sem contar marcas combinantes) é uma letra latina.
+        bool latinBase = false;
 
-            if ( ! std::isalpha( static_cast<unsigned char>( word[i] ) ) ) return false;
+        std::size_t i = 0;
 
-        }
+        while( i < length ){
 
-        return true;
+            if( bytes[i] < 0x80 ){
 
-    }
+                latinBase = isASCIILetter(bytes[i]);
 
-    /**
-     * Quebra uma string em um vetor de caracteres/graphemes considerando code points (Unicode).
-     *
-     * Esta função utiliza ICU para dividir a string em graphemes, ou seja, em unidades de texto visíveis,
-     * respeitando os code points Unicode. Isso é útil para manipulação correta de strings Unicode,
-     * onde um "caractere" pode ser composto por múltiplos bytes ou combinações de símbolos.
-     *
-     * @param string String de entrada a ser quebrada em graphemes.
-     * @return std::vector<std::string> Vetor contendo cada grapheme (caractere visual) da string original.
-     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
-     */
-    std::vector<std::string> explodeGraphemes( const std::string& string ) {
+                response += static_cast<char>(bytes[i]);
 
-        if(string.empty()) return {};
-
-        std::string input = string;
+                i++;
 
-        icu::UnicodeString inputUnicode(input.c_str(), "UTF-8");
+                continue;
 
-        UErrorCode status = U_ZERO_ERROR;
+            }
 
-        std::unique_ptr<icu::BreakIterator> it(
-            icu::BreakIterator::createCharacterInstance(icu::Locale::getDefault(), status)
-        );
+            std::size_t start = i;
 
-        if ( U_FAILURE(status) ) {
+            UChar32 c;
 
-            std::string error = u_errorName(status);
+            U8_NEXT(bytes, i, length, c);
 
-            throw std::runtime_error("ICU Erro: " + error);
+            bool mark = ( c >= 0x0300 && c <= 0x036F );
 
-        }
+            if( mark && latinBase ) continue;
 
-        std::vector<std::string> explode;
+            unsigned char folded = ( c < 0 || mark ) ? 0 : table.fold(c);
 
-        it->setText(inputUnicode);
+            if(folded != 0){
 
-        int32_t start = it->first();
-        int32_t end = it->next();
+                latinBase = true;
 
-        while( end != icu::BreakIterator::DONE ){
+                response += static_cast<char>(folded);
 
-            icu::UnicodeString grapheme = inputUnicode.tempSubStringBetween(start, end);
-            
-            std::string utf8;
+                continue;
 
-            grapheme.toUTF8String(utf8);
+            }
 
-            explode.push_back(utf8);
+            if( ! mark ) latinBase = ( c >= 0 ) && isLatinBase(c);
 
-            start = end;
+            response.append( reinterpret_cast<const char*>(bytes + start), i - start );
 
-            end = it->next();
+            kept = true;
 
         }
 
-        return explode;
+        if(kept) response = forcaStrings::normalize( std::move(response), "NFC" );
+
+        return response;
 
     }
 
     /**
-     * Calcula o tamanho de uma string com base nos caracteres visíveis (graphemes/code points Unicode).
+     * Locale fixo usado no mapeamento de caixa. O jogo é em português, então a conversão não depende
+     * do locale padrão do processo (que, em turco ou azeri, mudaria a caixa de 'i' e 'I').
+     */
+    static constexpr const char* CASE_LOCALE = "pt_BR";
+
+    /**
+     * Retorna o UCaseMap da thread atual, com o locale CASE_LOCALE já resolvido.
      *
-     * Esta função retorna a quantidade de caracteres visuais presentes na string, considerando corretamente
-     * caracteres Unicode que podem ocupar múltiplos bytes. Diferente de std::string::size(), que retorna o
-     * número de bytes, esta função utiliza ICU para contar os graphemes/code points, fornecendo o tamanho real
-     * percebido pelo usuário.
+     * O UCaseMap é criado uma única vez por thread e reaproveitado entre as chamadas, de modo que
+     * a conversão de caixa não consulta o locale a cada uso.
      *
-     * @param string String de entrada a ser analisada.
-     * @return std::string::size_type Quantidade de caracteres visíveis (graphemes) na string.
+     * @return UCaseMap* Mapeador de caixa da thread atual.
      * @throws std::runtime_error Em caso de erro na biblioteca ICU.
      */
-    std::string::size_type VisibleLength( const std::string& string ) {
+    static UCaseMap* caseMap() {
 
-        std::string input = string;
+        thread_local std::unique_ptr<UCaseMap, decltype(&ucasemap_close)> instance(nullptr, &ucasemap_close);
 
-        icu::UnicodeString inputUnicode(input.c_str(), "UTF-8");
+        if( !instance ){
 
-        UErrorCode status = U_ZERO_ERROR;
+            UErrorCode status = U_ZERO_ERROR;
 
-        std::unique_ptr<icu::BreakIterator> it(
-            icu::BreakIterator::createCharacterInstance(icu::Locale::getDefault(), status)
-        );
+            instance.reset( ucasemap_open(CASE_LOCALE, U_FOLD_CASE_DEFAULT, &status) );
 
-        if ( U_FAILURE(status) ) {
+            if ( U_FAILURE(status) ) {
 
-            std::string error = u_errorName(status);
+                instance.reset();
 
-            throw std::runtime_error("ICU Erro: " + error);
+                std::string error = u_errorName(status);
+
+                throw std::runtime_error("ICU Erro: " + error);
+
+            }
 
         }
 
-        it->setText(inputUnicode);
+        return instance.get();
 
-        int32_t start = it->first();
-        int32_t end = it->next();
+    }
 
-        std::string::size_type length = 0;
+    /**
+     * Converte a caixa de uma string UTF-8 diretamente em UTF-8, escrevendo no buffer informado.
+     *
+     * Strings puramente ASCII são convertidas nos próprios bytes. As demais passam por ucasemap_utf8ToUpper/ToLower,
+     * sem conversão para UTF-16. O buffer é reaproveitado: quando a capacidade atual já é suficiente, nada é alocado.
+     * Sequências UTF-8 inválidas são copiadas sem alteração.
+     *
+     * @param string    String a ser convertida (UTF-8).
+     * @param output    Buffer que recebe o resultado. Seu conteúdo anterior é descartado.
+     * @param upper     true para maiúsculas, false para minúsculas.
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
+     */
+    static void caseMapUTF8( std::string_view string, std::string& output, bool upper ) {
 
-        while( end != icu::BreakIterator::DONE ){
+        if( forcaStrings::isASCII(string) ){
 
-            length++;
+            output.assign( string.data(), string.length() );
 
-            start = end;
+            asciiCaseMap(output, upper);
 
-            end = it->next();
+            return;
 
         }
 
-        return length;
-
-    }
+        if( string.length() > static_cast<std::size_t>( std::numeric_limits<int32_t>::max() ) ){
+            throw std::length_error("A string é grande demais para a conversão de caixa.");
+        }
 
-    /**
-     * Retorna o tamanho da string com base em unidades UTF-16.
-     *
-     * Esta função utiliza ICU para calcular o comprimento da string em termos de unidades de código UTF-16,
-     * que pode ser diferente do número de caracteres visíveis (graphemes) ou do número de bytes.
-     * Útil para operações que dependem da codificação interna UTF-16, como APIs que trabalham diretamente com UnicodeString.
-     *
-     * @param string String de entrada a ser analisada.
-     * @return std::string::size_type Quantidade de unidades UTF-16 na string.
-     */
-    std::string::size_type Length( const std::string& string ) {
+        UCaseMap* map = caseMap();
 
-        std::string input = string;
+        int32_t sourceLength = static_cast<int32_t>( string.length() );
 
-        icu::UnicodeString inputUnicode(input.c_str(), "UTF-8");
+        auto convert = [&]( int32_t capacity, UErrorCode& status ) -> int32_t {
 
-        std::string::size_type length = inputUnicode.length();
+            if(upper) return ucasemap_utf8ToUpper( map, &output[0], capacity, string.data(), sourceLength, &status );
 
-        return length;
+            return ucasemap_utf8ToLower( map, &output[0], capacity, string.data(), sourceLength, &status );
 
-    }    
+        };
 
-    /**
-     * Retorna o caractere visível (grapheme/code point Unicode) na posição informada da string.
-     *
-     * Esta função retorna o caractere visual (grapheme) na posição especificada, levando em consideração
-     * os code points Unicode, e não apenas bytes individuais. Assim, a posição é baseada no que o usuário
-     * percebe como "caracteres", mesmo que ocupem múltiplos bytes.
-     *
-     * Inspirada na função charAt do JavaScript, mas adaptada para suportar Unicode corretamente em C++.
-     *
-     * @param string String de entrada.
-     * @param index  Índice do caractere desejado (baseado em graphemes/code points Unicode).
-     * @return std::string Caractere visual na posição informada, ou string vazia se a string for vazia.
-     * @throws std::out_of_range Se o índice for maior ou igual ao número de caracteres visíveis.
-     */
-    std::string charAt( const std::string& string, std::string::size_type index ) {
+        // A maioria das conversões mantém o tamanho; alguns caracteres crescem (ex: "ß" -> "SS").
+        output.resize( string.length() + string.length() / 2 + 16 );
 
-        if(string.empty()) return "";
+        UErrorCode status = U_ZERO_ERROR;
 
-        std::string::size_type length = forcaStrings::VisibleLength(string);
+        int32_t length = convert( static_cast<int32_t>( output.size() ), status );
 
-        if(index >= length) throw std::out_of_range("forcaStrings::charAt: index (which is " + std::to_string(index) + ") >= this->length() (which is " + std::to_string(length) + ")");
+        if( status == U_BUFFER_OVERFLOW_ERROR ){
 
-        std::vector<std::string> explode = forcaStrings::explodeGraphemes(string);
+            output.resize( static_cast<std::size_t>(length) );
 
-        std::string charString = explode.at(index);
+            status = U_ZERO_ERROR;
 
-        return charString;
+            length = convert( length, status );
 
-    }
+        }
 
-    /**
-     * Repete uma string um número especificado de vezes.
-     *
-     * Esta função retorna uma nova string composta pela concatenação da string original repetida
-     * o número de vezes informado em count.
-     *
-     * Inspirada na função repeat do JavaScript.
-     *
-     * @param string String a ser repetida.
-     * @param count  Número de repetições.
-     * @return std::string String resultante da repetição.
-     */
-    std::string repeat( const std::string& string, std::string::size_type count ) {
+        if ( U_FAILURE(status) ) {
 
-        if(string.empty() || count == 0) return "";
+            output.clear();
 
-        std::string repeat;
+            std::string error = u_errorName(status);
 
-        std::string::size_type i;
+            throw std::runtime_error("ICU Erro: " + error);
 
-        for(i=0; i<count; i++){
-            repeat += string;
         }
 
-        return repeat;
+        output.resize( static_cast<std::size_t>(length) );
 
     }
 
     /**
-     * Extrai uma substring com base nos caracteres visíveis (graphemes/code points Unicode).
-     *
-     * Esta função retorna uma substring da string original, considerando corretamente os caracteres visuais
-     * (graphemes/code points Unicode), e não apenas o número de bytes. Assim, a extração é feita de acordo
-     * com o que o usuário percebe como "caracteres", mesmo que eles ocupem múltiplos bytes.
+     * Converte todos os caracteres de uma string para maiúsculos, escrevendo no buffer informado.
+     * Usa as regras de caixa do português do Brasil, independentemente do locale padrão.
      *
-     * @param string String de entrada.
-     * @param pos    Posição inicial (baseada em graphemes/code points Unicode).
-     * @param len    Comprimento da substring (em graphemes/code points Unicode).
-     * @return std::string Substring extraída, respeitando os caracteres visíveis.
-     * @throws std::out_of_range Se a posição inicial for maior que o tamanho da string.
+     * @param   string  String que será convertida para maiúsculo (UTF-8).
+     * @param   output  Buffer que recebe o resultado. Reaproveitar o mesmo buffer evita alocações.
+     * @throws  std::runtime_error Em caso de erro na biblioteca ICU.
      */
-    std::string substring( const std::string& string, std::size_t pos, std::size_t len ) {
+    void to_uppercase( std::string_view string, std::string& output ) {
 
-        std::string copy = string;
+        caseMapUTF8(string, output, true);
 
-        std::string::size_type length = forcaStrings::VisibleLength(copy);
-
-        if(pos > length) throw std::out_of_range("forcaStrings::substring: pos (which is " + std::to_string(pos) + ") > this->size() (which is " + std::to_string(length) + ")");
+    }
 
-        if(pos == length) return "";
+    /**
+     * Converte todos os caracteres de uma string para minúsculos, escrevendo no buffer informado.
+     * Usa as regras de caixa do português do Brasil, independentemente do locale padrão.
+     *
+     * @param   string  String que será convertida para minúsculo (UTF-8).
+     * @param   output  Buffer que recebe o resultado. Reaproveitar o mesmo buffer evita alocações.
+     * @throws  std::runtime_error Em caso de erro na biblioteca ICU.
+     */
+    void to_lowercase( std::string_view string, std::string& output ) {
 
-        if( len > (length - pos) ) len = length - pos;
+        caseMapUTF8(string, output, false);
 
-        std::vector<std::string> explode = forcaStrings::explodeGraphemes(copy);
+    }
 
-        std::vector<std::string> substr;
+    /**
+     * Converte todos os caracteres de uma string para maiúsculos. A função lida 
+     * corretamente com caracteres Unicode.
+     *
+     * @param   std::string text    String que será convertida para maiúsculo
+     * @return  std::string         String com todos os caracteres em maiúsculo
+     */
+    std::string to_uppercase( const std::string& string ) {
 
-        substr.assign( (explode.begin() + pos), ( explode.begin() + (pos + len) ) );
+        std::string response;
 
-        std::string substring = forcaStrings::implode(substr);
+        caseMapUTF8(string, response, true);
 
-        return substring;
+        return response;
 
     }
 
     /**
-     * Retorna o índice da primeira ocorrência de um caractere visível (grapheme/code point Unicode) em uma string.
-     *
-     * Esta função busca a primeira ocorrência exata do caractere (ou grapheme) informado, levando em consideração
-     * a divisão correta de caracteres Unicode (code points), e não apenas bytes. Assim, a busca é feita de acordo
-     * com o que o usuário percebe como "caracteres", mesmo que ocupem múltiplos bytes.
+     * Converte todos os caracteres de uma string para minúsculos. A função lida 
+     * corretamente com caracteres Unicode.
      *
-     * @param string String onde será feita a busca.
-     * @param search Caractere/grapheme a ser procurado (pode ser um code point Unicode).
-     * @return std::string::size_type Índice da primeira ocorrência do caractere/grapheme, ou std::string::npos se não encontrado.
+     * @param   std::string text    String que será convertida para minúsculo
+     * @return  std::string         String com todos os caracteres em minúsculo
      */
-    std::string::size_type firstIndexOf( const std::string& string, const std::string& search ) {
-
-        if(search.empty()) return std::string::npos;
-
-        std::vector<std::string> explode = forcaStrings::explodeGraphemes(string);
-
-        std::vector<std::string>::iterator index = std::find( explode.begin(), explode.end(), search);
+    std::string to_lowercase( const std::string& string ) {
 
-        if(index == explode.end()) return std::string::npos;
+        std::string response;
 
-        std::string::size_type pos = std::distance(explode.begin(), index);
+        caseMapUTF8(string, response, false);
 
-        return pos;
+        return response;
 
     }
 
     /**
-     * Retorna o índice da última ocorrência de um caractere visível (grapheme/code point Unicode) em uma string.
-     *
-     * Esta função busca a última ocorrência exata do caractere (ou grapheme) informado, levando em consideração
-     * a divisão correta de caracteres Unicode (code points), e não apenas bytes. Assim, a busca é feita de acordo
-     * com o que o usuário percebe como "caracteres", mesmo que ocupem múltiplos bytes.
+     * Avança sobre os espaços em branco Unicode a partir do início do intervalo [begin, end) de um buffer UTF-8.
+     * Bytes ASCII são classificados diretamente; os demais code points são decodificados com U8_NEXT e
+     * classificados com u_isUWhiteSpace. Sequências inválidas são tratadas como caracteres que não são espaço.
      *
-     * @param string String onde será feita a busca.
-     * @param search Caractere/grapheme a ser procurado (pode ser um code point Unicode).
-     * @return std::string::size_type Índice da última ocorrência do caractere/grapheme, ou std::string::npos se não encontrado.
+     * @param bytes Buffer UTF-8.
+     * @param begin Offset inicial.
+     * @param end   Offset final (exclusivo).
+     * @return std::size_t Offset do primeiro code point que não é espaço, ou end.
      */
-    std::string::size_type lastIndexOf( const std::string& string, const std::string& search ) {
+    static std::size_t skipWhiteSpaceForward( const uint8_t* bytes, std::size_t begin, std::size_t end ) {
 
-        if(search.empty()) return std::string::npos;
+        while( begin < end ){
+
+            if( bytes[begin] < 0x80 ){
+
+                if( ! isASCIIWhiteSpace(bytes[begin]) ) break;
+
+                begin++;
+
+                continue;
 
-        std::vector<std::string> explode = forcaStrings::explodeGraphemes(string);
+            }
+
+            std::size_t next = begin;
+
+            UChar32 c;
 
-        auto index = std::find( explode.rbegin(), explode.rend(), search);
+            U8_NEXT(bytes, next, end, c);
 
-        if(index == explode.rend()) return std::string::npos;
+            if( c < 0 || ! u_isUWhiteSpace(c) ) break;
 
-        std::string::size_type pos = std::distance( explode.begin(), (index.base() - 1) );
+            begin = next;
 
-        return pos;
+        }
+
+        return begin;
 
     }
 
     /**
-     * Divide uma string em um vetor de strings usando um separador.
-     * Esta versão trabalha com strings passadas por referência constante.
-     * 
-     * Essa função foi inspirada pela função explode do PHP.
-     * 
-     * @note Por preferência pessoal, a implementação ideal seria retornar um std::vector<std::string> e utilizar um loop while,
-     *       mas optei por esta abordagem recursiva com ponteiro para demonstrar conhecimento em manipulação de ponteiros e recursividade.
-     * 
-     * @param   const std::string& string    String a ser dividida
-     * @param   const std::string& separator        String usada como separador
-     * @param   std::vector<std::string>* reference    Ponteiro para o vetor que armazenará os resultados
-     * @return  void
+     * Recua sobre os espaços em branco Unicode a partir do fim do intervalo [begin, end) de um buffer UTF-8.
+     * Para bytes não ASCII, volta até o byte líder (no máximo 3 bytes de continuação) e decodifica o code point
+     * com U8_NEXT; só o considera espaço se a sequência for válida e terminar exatamente em end.
+     *
+     * @param bytes Buffer UTF-8.
+     * @param begin Offset inicial, que limita o recuo.
+     * @param end   Offset final (exclusivo).
+     * @return std::size_t Offset logo após o último code point que não é espaço, ou begin.
      */
-    void explode( const std::string& string, const std::string& separator, std::vector<std::string>* reference, std::size_t limit ) {
-
-        if(limit == 0 || reference->size() >= limit) return;
+    static std::size_t skipWhiteSpaceBackward( const uint8_t* bytes, std::size_t begin, std::size_t end ) {
 
-        /*         
-            Cria uma cópia da string de entrada.
-            Isso é preciso pois se uma string const for passada, não será possível
-            modificar, e também evita alterar strings originais, já que são passadas por referência. 
-        */
-        std::string copy = string;
+        while( end > begin ){
 
-        std::string::size_type separatorLength = separator.length();
+            if( bytes[end - 1] < 0x80 ){
 
-        if(separatorLength == 0){
+                if( ! isASCIIWhiteSpace(bytes[end - 1]) ) break;
 
-            /* 
-                Quando o separador é uma string vazia (""), o objetivo é quebrar a string em um vetor de caracteres visuais (graphemes),
-                levando em consideração code points (Unicode). Isso é importante porque um "caractere" visual pode ser composto por múltiplos bytes,
-                e a divisão correta deve respeitar a representação visual e não apenas os bytes individuais. Para isso, utilizamos a função
-                explodeGraphemes, que trata corretamente os code points Unicode. Após obter os graphemes, o ajuste do limite é feito manualmente.
-            */
+                end--;
 
-            std::vector<std::string> explode = forcaStrings::explodeGraphemes(copy);
+                continue;
 
-            while( ( reference->size() + 1 ) < limit && !explode.empty() ){
+            }
 
-                reference->push_back(explode[0]);
+            std::size_t start = end - 1;
 
-                explode.erase( explode.begin() );
+            while( start > begin && ( end - start ) < 4 && U8_IS_TRAIL(bytes[start]) ) start--;
 
-            }
+            std::size_t next = start;
 
-            if( !explode.empty() && limit != 0 ){
+            UChar32 c;
 
-                reference->push_back( forcaStrings::implode(explode) );
+            U8_NEXT(bytes, next, end, c);
 
-            }
+            if( next != end || c < 0 || ! u_isUWhiteSpace(c) ) break;
 
-            return;
+            end = start;
 
         }
-        
-        /*
-            Quando o separador possui tamanho maior que zero, a busca e quebra da string é feita normalmente usando find e substr,
-            pois a posição do separador na string não depende da quantidade de bytes de cada caractere, mas sim da posição lógica
-            onde o separador ocorre. Além disso, o código já considera corretamente o tamanho do separador (separatorLength), permitindo
-            separadores com múltiplos bytes ou múltiplos caracteres. Isso garante que a divisão será feita exatamente após o separador,
-            independentemente de seu tamanho ou conteúdo.
-        */
 
-        std::string::size_type pos = copy.find(separator);
+        return end;
 
-        if( separatorLength > 0 && pos != std::string::npos && ( reference->size() + 1 ) < limit ) {
+    }
 
-            std::string substr = copy.substr(0, pos);
+    /**
+     * Remove espaços em branco do início e do fim de uma string, sem cópia.
+     *
+     * @param   std::string_view string    String que terá os espaços removidos
+     * @return  std::string_view           Recorte da string original sem espaços no início e fim
+     */
+    std::string_view trim_view( std::string_view string ) {
 
-            reference->push_back(substr);
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>( string.data() );
 
-            copy = copy.erase( 0, pos + separatorLength );
+        std::size_t begin = skipWhiteSpaceForward( bytes, 0, string.length() );
 
-            explode(copy, separator, reference, limit);
+        std::size_t end = skipWhiteSpaceBackward( bytes, begin, string.length() );
 
-        }
-        else{
-            reference->push_back(copy);
-        }
+        return string.substr(begin, end - begin);
 
     }
 
     /**
-     * Divide uma string em um vetor de strings usando um separador.
-     * Esta versão trabalha com strings mutáveis (char*).
-     * 
-     * @note Por preferência pessoal, a implementação ideal seria retornar um std::vector<std::string> e utilizar um loop while,
-     *       mas optei por esta abordagem recursiva com ponteiro para demonstrar conhecimento em manipulação de ponteiros e recursividade.      
+     * Remove espaços em branco do início de uma string (left trim), sem cópia.
      *
-     * @param   char* string                 String a ser dividida
-     * @param   const std::string& separator        String usada como separador
-     * @param   std::vector<std::string>* reference    Ponteiro para o vetor que armazenará os resultados
-     * @return  void
+     * @param   std::string_view string    String que terá os espaços removidos do início
+     * @return  std::string_view           Recorte da string original sem espaços no início
      */
-    void explode( char* string, const std::string& separator, std::vector<std::string>* reference, std::size_t limit ) {
+    std::string_view ltrim_view( std::string_view string ) {
+
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>( string.data() );
 
-        explode(string, separator, reference, limit);
+        return string.substr( skipWhiteSpaceForward( bytes, 0, string.length() ) );
 
     }
 
     /**
-     * Divide uma string em um vetor de strings usando um separador.
-     * Esta versão trabalha com strings constantes (const char*).
-     * 
-     * @note Por preferência pessoal, a implementação ideal seria retornar um std::vector<std::string> e utilizar um loop while,
-     *       mas optei por esta abordagem recursiva com ponteiro para demonstrar conhecimento em manipulação de ponteiros e recursividade.     
-     * 
-     * @param   const char* string           String a ser dividida
-     * @param   const std::string& separator        String usada como separador
-     * @param   std::vector<std::string>* reference    Ponteiro para o vetor que armazenará os resultados
-     * @return  void
+     * Remove espaços em branco do fim de uma string (right trim), sem cópia.
+     *
+     * @param   std::string_view string    String que terá os espaços removidos do fim
+     * @return  std::string_view           Recorte da string original sem espaços no fim
      */
-    void explode( const char* string, const std::string& separator, std::vector<std::string>* reference, std::size_t limit ) {
+    std::string_view rtrim_view( std::string_view string ) {
 
-        explode(string, separator, reference, limit);
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>( string.data() );
+
+        return string.substr( 0, skipWhiteSpaceBackward( bytes, 0, string.length() ) );
 
     }
 
     /**
-     * Concatena elementos de um vetor de strings usando um delimitador.
-     * Esta versão trabalha com std::vector<std::string>.
+     * Remove espaços em branco do início e do fim de uma string.
+     * Combina as funcionalidades de ltrim() e rtrim() em uma única chamada.
      * 
-     * Essa função foi inspirada na função implode do PHP.
+     * Inspirado na função PHP trim().
      * 
-     * @param   const std::vector<std::string>& array    Vetor de strings a ser concatenado
-     * @param   const std::string& delimiter                    String usada como delimitador
-     * @return  std::string                             String resultante da concatenação
+     * @param   const std::string& string    String que terá os espaços removidos
+     * @return  std::string                  String sem espaços no início e fim
      */
-    std::string implode( const std::vector<std::string>& array, const std::string& delimiter ) {
+    std::string trim( const std::string& string ) {
 
-        if(array.empty()) return "";
+        return std::string( forcaStrings::trim_view(string) );
 
-        std::size_t i, length = array.size();
+    }
+
+    /**
+     * Remove espaços em branco do início de uma string (left trim).
+     * Remove espaços, tabs, quebras de linha e outros caracteres de espaçamento
+     * do início da string.
+     * 
+     * Inspirado na função PHP ltrim().
+     * 
+     * @param   const std::string& string    String que terá os espaços removidos do início
+     * @return  std::string                  String sem espaços no início
+     */
+    std::string ltrim( const std::string& string ) {
+
+        return std::string( forcaStrings::ltrim_view(string) );
+
+    }
+
+    /**
+     * Remove espaços em branco do fim de uma string (right trim).
+     * Remove espaços, tabs, quebras de linha e outros caracteres de espaçamento
+     * do final da string.
+     * 
+     * Inspirado na função PHP rtrim().
+     * 
+     * @param   const std::string& string    String que terá os espaços removidos do fim
+     * @return  std::string                  String sem espaços no fim
+     */
+    std::string rtrim( const std::string& string ) {
+
+        return std::string( forcaStrings::rtrim_view(string) );
+
+    }
+
+    /**
+     * Normaliza uma string removendo espaços, acentos e convertendo para maiúsculo.
+     * Esta função combina as operações de removeSpaces(), removeAcentos() e 
+     * to_uppercase() em uma única chamada.
+     *
+     * As três etapas são feitas em uma única passada sobre o UTF-8: espaços e marcas combinantes que seguem letras latinas são descartados,
+     * letras latinas acentuadas passam pela LatinFoldTable e o restante é copiado. Quando a saída só tem ASCII,
+     * a conversão para maiúsculo é feita nos próprios bytes. Se sobrar algum caractere não latino, a normalização NFC
+     * só é feita quando Normalizer2::isNormalizedUTF8 (dentro de normalize()) indica que a saída ainda não está em NFC, e a caixa é convertida pela ICU.
+     * Bytes UTF-8 inválidos usam as três funções em sequência, garantindo sempre o mesmo resultado, byte a byte, de removeSpaces() -> removeAcentos() -> to_uppercase().
+     *
+     * @param   std::string text    String que será normalizada
+     * @return  std::string         String normalizada sem espaços, acentos e em maiúsculo
+     */
+    std::string normalizeWord( const std::string& string ) {
+
+        const LatinFoldTable& table = latinFoldTable();
+
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>( string.data() );
+
+        std::size_t length = string.length();
+
+        std::string response;
+
+        response.reserve(length);
+
+        bool kept = false;
+
+        // Mesmo controle de removeAcentos(): marcas combinantes só são descartadas depois de uma letra latina.
+        // Espaços não alteram o estado, pois removeSpaces() os removeria antes.
+        bool latinBase = false;
+
+        std::size_t i = 0;
+
+        while( i < length ){
+
+            if( bytes[i] < 0x80 ){
+
+                if( ! isASCIIWhiteSpace(bytes[i]) ){
+
+                    latinBase = isASCIILetter(bytes[i]);
+
+                    response += static_cast<char>(bytes[i]);
+
+                }
+
+                i++;
+
+                continue;
+
+            }
+
+            std::size_t start = i;
+
+            UChar32 c;
+
+            U8_NEXT(bytes, i, length, c);
+
+            /*
+                Com bytes inválidos, remover um espaço pode juntar duas metades de uma sequência em um caractere válido
+                antes de removeAcentos(). Para manter o resultado idêntico, esse caso usa as funções em sequência.
+            */
+            if( c < 0 ){
+                return forcaStrings::to_uppercase( forcaStrings::removeAcentos( forcaStrings::removeSpaces(string) ) );
+            }
+
+            if( u_isUWhiteSpace(c) ) continue;
+
+            bool mark = ( c >= 0x0300 && c <= 0x036F );
+
+            if( mark && latinBase ) continue;
+
+            unsigned char folded = mark ? 0 : table.fold(c);
+
+            if(folded != 0){
+
+                latinBase = true;
+
+                response += static_cast<char>(folded);
+
+                continue;
+
+            }
+
+            if( ! mark ) latinBase = isLatinBase(c);
+
+            response.append( reinterpret_cast<const char*>(bytes + start), i - start );
+
+            kept = true;
+
+        }
+
+        if( ! kept ){
+
+            asciiCaseMap(response, true);
+
+            return response;
+
+        }
+
+        response = forcaStrings::normalize( std::move(response), "NFC" );
+
+        return forcaStrings::to_uppercase(response);
+
+    }
+
+    /**
+     * Normaliza quebras de linha em uma string, convertendo diferentes tipos de quebra
+     * para o formato Unix (\n).
+     * 
+     * Converte as seguintes sequências para \n:
+     * - \r\n (Windows)
+     * - \v (Vertical tab)
+     * - \f (Form feed)
+     * - \n (Unix)
+     *
+     * @param   const std::string& text    String que terá as quebras de linha normalizadas
+     * @return  std::string               String com quebras de linha normalizadas para \n
+     */
+    std::string normalizeLineBreaks( const std::string& text ) {
+
+        return forcaRegex::preg_replace(forcaRegex::StaticPattern<forcaRegex::builtins::LINE_BREAK>::get(), text, "\n");
+
+    }
+
+    /**
+     * Remove quebras de linha múltiplas consecutivas, substituindo-as por uma única quebra.
+     * 
+     * Por exemplo:
+     * "texto\n\n\n\ntexto" se torna "texto\ntexto"
+     *
+     * @param   const std::string& text    String que terá as quebras de linha extras removidas
+     * @return  std::string               String com apenas quebras de linha simples
+     */
+    std::string removeExtraLineBreaks( const std::string& text, bool normalize ) {
+
+        if(normalize){
+            return forcaRegex::preg_replace(forcaRegex::StaticPattern<forcaRegex::builtins::LINE_BREAKS>::get(), text, "\n");
+        }
+        else{
+            return forcaRegex::preg_replace(forcaRegex::StaticPattern<forcaRegex::builtins::LINE_BREAKS_GROUP>::get(), text, "$1");
+        }
+
+    }
+
+    /*
+    |=============================
+    |   FUNÇÕES DE VERIFICAÇÃO
+    |=============================
+    */
+
+    /**
+     * Verifica se um code point fora do ASCII é aceito como parte de uma palavra no conjunto de letras informado.
+     *
+     * Marcas combinantes (acentos em strings NFD) são aceitas quando seguem uma letra aceita,
+     * de modo que "á" é aceito tanto na forma composta quanto na decomposta.
+     *
+     * @param c             Code point (>= 0x80).
+     * @param script        Conjunto de letras aceitas.
+     * @param afterLetter   true se o code point anterior foi uma letra aceita.
+     * @return bool true se o code point for aceito.
+     */
+    static bool isAlphaCodePoint( UChar32 c, AlphaScript script, bool afterLetter ) {
+
+        if( script == AlphaScript::ASCII ) return false;
+
+        if( afterLetter && ( U_GET_GC_MASK(c) & U_GC_M_MASK ) ) return true;
+
+        if( ! u_isalpha(c) ) return false;
+
+        if( script == AlphaScript::ANY ) return true;
+
+        UErrorCode status = U_ZERO_ERROR;
+
+        return uscript_getScript(c, &status) == USCRIPT_LATIN && U_SUCCESS(status);
+
+    }
+
+    /**
+     * Converte o nome de um conjunto de letras ("ascii", "latin" ou "any") para AlphaScript.
+     *
+     * @param name Nome do conjunto de letras.
+     * @return AlphaScript Conjunto correspondente.
+     * @throws std::invalid_argument Caso o nome não seja reconhecido.
+     */
+    AlphaScript alphaScriptFromName( const std::string& name ) {
+
+        if( name == "ascii" ) return AlphaScript::ASCII;
+
+        if( name == "latin" ) return AlphaScript::LATIN;
+
+        if( name == "any" ) return AlphaScript::ANY;
+
+        throw std::invalid_argument("O conjunto de letras deve ser um dos seguintes: ascii, latin, any.");
+
+    }
+
+    /**
+     * Verifica se uma string contém apenas caracteres alfabéticos do conjunto de letras informado.
+     *
+     * Blocos de 16 bytes que são só letras ASCII são aceitos de uma vez com SSE2, quando disponível.
+     * Somente os demais bytes são verificados individualmente: os ASCII diretamente e os multibyte
+     * decodificados com U8_NEXT e classificados com u_isalpha (e uscript_getScript, para LATIN).
+     * A verificação não depende do locale do processo. Sequências UTF-8 inválidas não são letras.
+     *
+     * @param   word    String a ser verificada (UTF-8).
+     * @param   script  Conjunto de letras aceitas (padrão: apenas A-Z e a-z).
+     * @return  bool    true se todos os caracteres são letras, false caso contrário.
+     */
+    bool checkAlphaCharacters( std::string_view word, AlphaScript script ) {
+
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>( word.data() );
+
+        std::size_t length = word.length();
+
+        std::size_t i = 0;
+
+        bool afterLetter = false;
+
+#ifdef FORCA_STRINGS_SSE2
+
+        const __m128i caseBit = _mm_set1_epi8(0x20);
+
+        const __m128i letterA = _mm_set1_epi8('a');
+
+        const __m128i lastOffset = _mm_set1_epi8(25);
+
+#endif
+
+        while( i < length ){
+
+#ifdef FORCA_STRINGS_SSE2
+
+            // (c | 0x20) - 'a' <= 25, sem sinal: bytes fora do ASCII nunca passam nesse teste.
+            for(; i + 16 <= length; i += 16){
+
+                __m128i offset = _mm_sub_epi8( _mm_or_si128( _mm_loadu_si128( reinterpret_cast<const __m128i*>(bytes + i) ), caseBit ), letterA );
+
+                if( _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_min_epu8(offset, lastOffset), offset ) ) != 0xFFFF ) break;
+
+                afterLetter = true;
+
+            }
+
+#endif
+
+            std::size_t stop = std::min( length, i + 16 );
+
+            while( i < stop ){
+
+                if( bytes[i] < 0x80 ){
+
+                    if( ! isASCIILetter(bytes[i]) ) return false;
+
+                    afterLetter = true;
+
+                    i++;
+
+                    continue;
+
+                }
+
+                if( script == AlphaScript::ASCII ) return false;
+
+                UChar32 c;
+
+                U8_NEXT(bytes, i, length, c);
+
+                if( c < 0 || ! isAlphaCodePoint(c, script, afterLetter) ) return false;
+
+                afterLetter = true;
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+    /**
+     * Versão em lote de checkAlphaCharacters(): verifica cada palavra do array com o mesmo conjunto de letras.
+     *
+     * @param   words   Palavras a serem verificadas (UTF-8).
+     * @param   script  Conjunto de letras aceitas (padrão: apenas A-Z e a-z).
+     * @return  std::vector<bool>   Resultado de cada palavra, na mesma ordem do array.
+     */
+    std::vector<bool> checkAlphaCharacters( const std::vector<std::string>& words, AlphaScript script ) {
+
+        std::vector<bool> result;
+
+        result.reserve( words.size() );
+
+        for(const std::string& word : words) result.push_back( checkAlphaCharacters(word, script) );
+
+        return result;
+
+    }
+
+    /**
+     * Retorna o iterador de graphemes da thread atual, já posicionado sobre a string informada.
+     *
+     * O BreakIterator de caracteres é criado uma única vez por thread e reaproveitado entre as chamadas,
+     * evitando carregar as regras de quebra da ICU a cada uso. O texto é entregue ao iterador através de um
+     * UText aberto diretamente sobre o buffer UTF-8, sem cópia para UTF-16, de modo que as fronteiras
+     * retornadas já são offsets em bytes da string original.
+     *
+     * @note O iterador referencia o buffer da string, que deve continuar válido enquanto ele for percorrido.
+     *       Uma nova chamada na mesma thread reposiciona o iterador sobre o novo texto.
+     *
+     * @param string String que será percorrida.
+     * @return icu::BreakIterator& Iterador posicionado no início da string.
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
+     */
+    static icu::BreakIterator& graphemeIterator( std::string_view string ) {
+
+        thread_local std::unique_ptr<icu::BreakIterator> iterator;
+
+        UErrorCode status = U_ZERO_ERROR;
+
+        if( !iterator ){
+
+            iterator.reset( icu::BreakIterator::createCharacterInstance(icu::Locale::getDefault(), status) );
+
+            if ( U_FAILURE(status) ) {
+
+                iterator.reset();
+
+                std::string error = u_errorName(status);
+
+                throw std::runtime_error("ICU Erro: " + error);
+
+            }
+
+        }
+
+        /*
+            O BreakIterator guarda um clone raso do UText, então o UText local pode ser fechado logo após o setText.
+            O clone continua apontando para o buffer da string, sem nenhuma cópia dos bytes.
+        */
+        UText text = UTEXT_INITIALIZER;
+
+        utext_openUTF8( &text, string.data(), static_cast<int64_t>( string.length() ), &status );
+
+        iterator->setText( &text, status );
+
+        utext_close( &text );
+
+        if ( U_FAILURE(status) ) {
+
+            std::string error = u_errorName(status);
+
+            throw std::runtime_error("ICU Erro: " + error);
+
+        }
+
+        return *iterator;
+
+    }
+
+    /**
+     * Retorna as fronteiras de graphemes (caracteres visíveis) de uma string, em uma única passada do BreakIterator da thread.
+     *
+     * As fronteiras ficam em um único vetor contíguo de offsets em bytes, incluindo 0 e o tamanho da string,
+     * então o grapheme i ocupa [boundaries[i], boundaries[i + 1]) e a string possui boundaries.size() - 1 graphemes.
+     * Diferente de explodeGraphemes(), nenhuma string é criada por grapheme; use graphemeAt() para ler cada um como view.
+     *
+     * @param string String UTF-8.
+     * @return std::vector<std::uint32_t> Offsets em bytes das fronteiras.
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
+     */
+    std::vector<std::uint32_t> graphemeBoundaries( std::string_view string ) {
+
+        std::vector<std::uint32_t> offsets{0};
+
+        if( string.empty() ) return offsets;
+
+        icu::BreakIterator& it = graphemeIterator(string);
+
+        it.first();
+
+        int32_t end = it.next();
+
+        while( end != icu::BreakIterator::DONE ){
+
+            offsets.push_back( static_cast<std::uint32_t>(end) );
+
+            end = it.next();
+
+        }
+
+        return offsets;
+
+    }
+
+    /**
+     * Retorna o grapheme de índice informado como view sobre a string, a partir das fronteiras de graphemeBoundaries().
+     *
+     * @param string     String UTF-8 usada para calcular as fronteiras.
+     * @param boundaries Fronteiras retornadas por graphemeBoundaries().
+     * @param index      Índice do grapheme.
+     * @return std::string_view Grapheme correspondente.
+     * @throws std::out_of_range Se o índice for maior ou igual ao número de graphemes.
+     */
+    std::string_view graphemeAt( std::string_view string, const std::vector<std::uint32_t>& boundaries, std::size_t index ) {
+
+        if( index + 1 >= boundaries.size() ) throw std::out_of_range("forcaStrings::graphemeAt: index (which is " + std::to_string(index) + ") >= this->length() (which is " + std::to_string( boundaries.empty() ? 0 : boundaries.size() - 1 ) + ")");
+
+        return string.substr( boundaries[index], boundaries[index + 1] - boundaries[index] );
+
+    }
+
+    /**
+     * Quebra uma string em um vetor de caracteres/graphemes considerando code points (Unicode).
+     *
+     * Esta função utiliza ICU para dividir a string em graphemes, ou seja, em unidades de texto visíveis,
+     * respeitando os code points Unicode. Isso é útil para manipulação correta de strings Unicode,
+     * onde um "caractere" pode ser composto por múltiplos bytes ou combinações de símbolos.
+     *
+     * @param string String de entrada a ser quebrada em graphemes.
+     * @return std::vector<std::string> Vetor contendo cada grapheme (caractere visual) da string original.
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
+     */
+    std::vector<std::string> explodeGraphemes( const std::string& string ) {
+
+        if(string.empty()) return {};
+
+        std::vector<std::uint32_t> boundaries = forcaStrings::graphemeBoundaries(string);
+
+        std::vector<std::string> explode;
+
+        explode.reserve( boundaries.size() - 1 );
+
+        std::size_t i;
+
+        for(i = 0; i + 1 < boundaries.size(); i++){
+
+            explode.emplace_back( string, boundaries[i], boundaries[i + 1] - boundaries[i] );
+
+        }
+
+        return explode;
+
+    }
+
+    /**
+     * Calcula o tamanho de uma string com base nos caracteres visíveis (graphemes/code points Unicode).
+     *
+     * Esta função retorna a quantidade de caracteres visuais presentes na string, considerando corretamente
+     * caracteres Unicode que podem ocupar múltiplos bytes. Diferente de std::string::size(), que retorna o
+     * número de bytes, esta função utiliza ICU para contar os graphemes/code points, fornecendo o tamanho real
+     * percebido pelo usuário.
+     *
+     * @param string String de entrada a ser analisada.
+     * @return std::string::size_type Quantidade de caracteres visíveis (graphemes) na string.
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
+     */
+    std::string::size_type VisibleLength( const std::string& string ) {
+
+        if(string.empty()) return 0;
+
+        icu::BreakIterator& it = graphemeIterator(string);
+
+        std::string::size_type length = 0;
+
+        it.first();
+
+        while( it.next() != icu::BreakIterator::DONE ) length++;
+
+        return length;
+
+    }
+
+    /**
+     * Retorna o tamanho da string com base em unidades UTF-16.
+     *
+     * Esta função utiliza ICU para calcular o comprimento da string em termos de unidades de código UTF-16,
+     * que pode ser diferente do número de caracteres visíveis (graphemes) ou do número de bytes.
+     * Útil para operações que dependem da codificação interna UTF-16, como APIs que trabalham diretamente com UnicodeString.
+     *
+     * @param string String de entrada a ser analisada.
+     * @return std::string::size_type Quantidade de unidades UTF-16 na string.
+     */
+    std::string::size_type Length( const std::string& string ) {
+
+        if( forcaStrings::isValidUTF8(string) ) return forcaStrings::countUTF16(string);
+
+        std::string input = string;
+
+        icu::UnicodeString inputUnicode(input.c_str(), "UTF-8");
+
+        std::string::size_type length = inputUnicode.length();
+
+        return length;
+
+    }    
+
+    /**
+     * Retorna o caractere visível (grapheme/code point Unicode) na posição informada da string.
+     *
+     * Esta função retorna o caractere visual (grapheme) na posição especificada, levando em consideração
+     * os code points Unicode, e não apenas bytes individuais. Assim, a posição é baseada no que o usuário
+     * percebe como "caracteres", mesmo que ocupem múltiplos bytes.
+     *
+     * Inspirada na função charAt do JavaScript, mas adaptada para suportar Unicode corretamente em C++.
+     *
+     * @param string String de entrada.
+     * @param index  Índice do caractere desejado (baseado em graphemes/code points Unicode).
+     * @return std::string Caractere visual na posição informada, ou string vazia se a string for vazia.
+     * @throws std::out_of_range Se o índice for maior ou igual ao número de caracteres visíveis.
+     */
+    std::string charAt( const std::string& string, std::string::size_type index ) {
+
+        if(string.empty()) return "";
+
+        icu::BreakIterator& it = graphemeIterator(string);
+
+        std::string::size_type length = 0;
+
+        int32_t start = it.first();
+        int32_t end = it.next();
+
+        while( end != icu::BreakIterator::DONE ){
+
+            if(length == index) return string.substr(start, end - start);
+
+            length++;
+
+            start = end;
+
+            end = it.next();
+
+        }
+
+        throw std::out_of_range("forcaStrings::charAt: index (which is " + std::to_string(index) + ") >= this->length() (which is " + std::to_string(length) + ")");
+
+    }
+
+    /**
+     * Repete uma string um número especificado de vezes.
+     *
+     * Esta função retorna uma nova string composta pela concatenação da string original repetida
+     * o número de vezes informado em count.
+     *
+     * Inspirada na função repeat do JavaScript.
+     *
+     * @param string String a ser repetida.
+     * @param count  Número de repetições.
+     * @return std::string String resultante da repetição.
+     */
+    std::string repeat( const std::string& string, std::string::size_type count ) {
+
+        if(string.empty() || count == 0) return "";
+
+        std::string repeat;
+
+        std::string::size_type i;
+
+        for(i=0; i<count; i++){
+            repeat += string;
+        }
+
+        return repeat;
+
+    }
+
+    /**
+     * Extrai uma substring com base nos caracteres visíveis (graphemes/code points Unicode).
+     *
+     * Esta função retorna uma substring da string original, considerando corretamente os caracteres visuais
+     * (graphemes/code points Unicode), e não apenas o número de bytes. Assim, a extração é feita de acordo
+     * com o que o usuário percebe como "caracteres", mesmo que eles ocupem múltiplos bytes.
+     *
+     * @param string String de entrada.
+     * @param pos    Posição inicial (baseada em graphemes/code points Unicode).
+     * @param len    Comprimento da substring (em graphemes/code points Unicode).
+     * @return std::string Substring extraída, respeitando os caracteres visíveis.
+     * @throws std::out_of_range Se a posição inicial for maior que o tamanho da string.
+     */
+    std::string substring( const std::string& string, std::size_t pos, std::size_t len ) {
+
+        icu::BreakIterator& it = graphemeIterator(string);
+
+        /*
+            Percorre as fronteiras uma única vez, guardando o offset em bytes do início (pos) e do fim (pos + len).
+            Quando pos está além do fim, o laço conta todos os graphemes para que a mensagem de erro informe o tamanho real.
+        */
+        std::string::size_type length = 0;
+
+        std::string::size_type begin = std::string::npos;
+
+        std::string::size_type finish = string.length();
+
+        int32_t boundary = it.first();
+
+        while( true ){
+
+            if(length == pos) begin = boundary;
+
+            if( begin != std::string::npos && (length - pos) == len ){
+
+                finish = boundary;
+
+                break;
+
+            }
+
+            boundary = it.next();
+
+            if(boundary == icu::BreakIterator::DONE) break;
+
+            length++;
+
+        }
+
+        if(begin == std::string::npos) throw std::out_of_range("forcaStrings::substring: pos (which is " + std::to_string(pos) + ") > this->size() (which is " + std::to_string(length) + ")");
+
+        return string.substr(begin, finish - begin);
+
+    }
+
+    /**
+     * Retorna o índice da primeira ocorrência de um caractere visível (grapheme/code point Unicode) em uma string.
+     *
+     * Esta função busca a primeira ocorrência exata do caractere (ou grapheme) informado, levando em consideração
+     * a divisão correta de caracteres Unicode (code points), e não apenas bytes. Assim, a busca é feita de acordo
+     * com o que o usuário percebe como "caracteres", mesmo que ocupem múltiplos bytes.
+     *
+     * @param string String onde será feita a busca.
+     * @param search Caractere/grapheme a ser procurado (pode ser um code point Unicode).
+     * @return std::string::size_type Índice da primeira ocorrência do caractere/grapheme, ou std::string::npos se não encontrado.
+     */
+    std::string::size_type firstIndexOf( const std::string& string, const std::string& search ) {
+
+        if(search.empty() || string.empty()) return std::string::npos;
+
+        icu::BreakIterator& it = graphemeIterator(string);
+
+        std::string_view view(string);
+
+        std::string::size_type pos = 0;
+
+        int32_t start = it.first();
+        int32_t end = it.next();
+
+        while( end != icu::BreakIterator::DONE ){
+
+            if( view.substr(start, end - start) == search ) return pos;
+
+            pos++;
+
+            start = end;
+
+            end = it.next();
+
+        }
+
+        return std::string::npos;
+
+    }
+
+    /**
+     * Retorna o índice da última ocorrência de um caractere visível (grapheme/code point Unicode) em uma string.
+     *
+     * Esta função busca a última ocorrência exata do caractere (ou grapheme) informado, levando em consideração
+     * a divisão correta de caracteres Unicode (code points), e não apenas bytes. Assim, a busca é feita de acordo
+     * com o que o usuário percebe como "caracteres", mesmo que ocupem múltiplos bytes.
+     *
+     * @param string String onde será feita a busca.
+     * @param search Caractere/grapheme a ser procurado (pode ser um code point Unicode).
+     * @return std::string::size_type Índice da última ocorrência do caractere/grapheme, ou std::string::npos se não encontrado.
+     */
+    std::string::size_type lastIndexOf( const std::string& string, const std::string& search ) {
+
+        if(search.empty() || string.empty()) return std::string::npos;
+
+        icu::BreakIterator& it = graphemeIterator(string);
+
+        std::string_view view(string);
+
+        std::string::size_type pos = 0;
+
+        std::string::size_type found = std::string::npos;
+
+        int32_t start = it.first();
+        int32_t end = it.next();
+
+        while( end != icu::BreakIterator::DONE ){
+
+            if( view.substr(start, end - start) == search ) found = pos;
+
+            pos++;
+
+            start = end;
+
+            end = it.next();
+
+        }
+
+        return found;
+
+    }
+
+
+    /**
+     * Cria um índice vazio, equivalente ao de uma string vazia.
+     */
+    GraphemeIndex::GraphemeIndex() : boundaries{0} {}
+
+    /**
+     * Cria o índice de graphemes da string informada.
+     *
+     * @param string String UTF-8 a ser indexada.
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
+     */
+    GraphemeIndex::GraphemeIndex( const std::string& string ) {
+
+        assign(string);
+
+    }
+
+    /**
+     * Reconstrói o índice para uma nova string.
+     *
+     * As fronteiras são obtidas em uma única passada do BreakIterator da thread. O vetor guarda também
+     * a fronteira inicial (0) e a final (tamanho em bytes), então o grapheme i ocupa [boundaries[i], boundaries[i + 1]).
+     * O índice só é alterado depois da segmentação terminar, então um erro da ICU não o deixa inconsistente.
+     *
+     * @param string String UTF-8 a ser indexada.
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
+     */
+    void GraphemeIndex::assign( const std::string& string ) {
+
+        std::vector<std::uint32_t> offsets = forcaStrings::graphemeBoundaries(string);
+
+        text = string;
+
+        boundaries.swap(offsets);
+
+    }
+
+    /**
+     * Retorna o offset em bytes do início do grapheme informado.
+     *
+     * @param index Índice do grapheme; index == length() retorna o tamanho da string em bytes.
+     * @return std::string::size_type Offset em bytes na string indexada.
+     * @throws std::out_of_range Se o índice for maior que o número de graphemes.
+     */
+    std::string::size_type GraphemeIndex::offset( std::string::size_type index ) const {
+
+        if(index > length()) throw std::out_of_range("forcaStrings::GraphemeIndex::offset: index (which is " + std::to_string(index) + ") > this->length() (which is " + std::to_string(length()) + ")");
+
+        return boundaries[index];
+
+    }
+
+    /**
+     * Retorna o grapheme na posição informada, como view sobre a string indexada.
+     *
+     * @param index Índice do grapheme.
+     * @return std::string_view Grapheme na posição informada.
+     * @throws std::out_of_range Se o índice for maior ou igual ao número de graphemes.
+     */
+    std::string_view GraphemeIndex::charAt( std::string::size_type index ) const {
+
+        if(index >= length()) throw std::out_of_range("forcaStrings::GraphemeIndex::charAt: index (which is " + std::to_string(index) + ") >= this->length() (which is " + std::to_string(length()) + ")");
+
+        return std::string_view(text).substr( boundaries[index], boundaries[index + 1] - boundaries[index] );
+
+    }
+
+    /**
+     * Retorna um trecho da string a partir de posições em graphemes, com a mesma semântica de forcaStrings::substring.
+     *
+     * @param pos Posição inicial (em graphemes).
+     * @param len Quantidade de graphemes; é limitada ao fim da string.
+     * @return std::string_view Trecho correspondente da string indexada.
+     * @throws std::out_of_range Se a posição inicial for maior que o número de graphemes.
+     */
+    std::string_view GraphemeIndex::slice( std::string::size_type pos, std::string::size_type len ) const {
+
+        std::string::size_type size = length();
+
+        if(pos > size) throw std::out_of_range("forcaStrings::GraphemeIndex::slice: pos (which is " + std::to_string(pos) + ") > this->size() (which is " + std::to_string(size) + ")");
+
+        if( len > (size - pos) ) len = size - pos;
+
+        return std::string_view(text).substr( boundaries[pos], boundaries[pos + len] - boundaries[pos] );
+
+    }
+
+    /**
+     * Retorna o índice do primeiro grapheme igual ao informado.
+     *
+     * @param search Grapheme procurado.
+     * @return std::string::size_type Índice do grapheme, ou std::string::npos se não encontrado.
+     */
+    std::string::size_type GraphemeIndex::firstIndexOf( std::string_view search ) const {
+
+        if(search.empty()) return std::string::npos;
+
+        std::string::size_type size = length();
+
+        std::string::size_type i;
+
+        for(i = 0; i < size; i++){
+
+            if( ( boundaries[i + 1] - boundaries[i] ) == search.length() && std::memcmp( text.data() + boundaries[i], search.data(), search.length() ) == 0 ) return i;
+
+        }
+
+        return std::string::npos;
+
+    }
+
+    /**
+     * Retorna o índice do último grapheme igual ao informado.
+     *
+     * @param search Grapheme procurado.
+     * @return std::string::size_type Índice do grapheme, ou std::string::npos se não encontrado.
+     */
+    std::string::size_type GraphemeIndex::lastIndexOf( std::string_view search ) const {
+
+        if(search.empty()) return std::string::npos;
+
+        std::string::size_type i = length();
+
+        while( i > 0 ){
+
+            i--;
+
+            if( ( boundaries[i + 1] - boundaries[i] ) == search.length() && std::memcmp( text.data() + boundaries[i], search.data(), search.length() ) == 0 ) return i;
+
+        }
+
+        return std::string::npos;
+
+    }
+
+    /**
+     * Retorna o índice de graphemes da thread atual para a string informada.
+     *
+     * O último índice construído em cada thread é mantido, e só é reconstruído quando o conteúdo da string muda.
+     * Assim, chamadas repetidas sobre a mesma string (por exemplo charAt em um laço feito no JavaScript)
+     * pagam a segmentação apenas uma vez. A comparação verifica primeiro o tamanho e só então o conteúdo,
+     * que para na primeira diferença.
+     *
+     * Strings maiores que CACHE_LIMIT (ex: conteúdos de arquivos) não passam pelo cache, para que a thread não mantenha
+     * uma cópia delas indefinidamente. Nesse caso, consultas isoladas devem usar as funções diretas (charAt, firstIndexOf...),
+     * que param assim que encontram o resultado, em vez de segmentar a string inteira.
+     *
+     * @note O ponteiro retornado é válido até a próxima chamada de cached na mesma thread.
+     *
+     * @param string String UTF-8 a ser indexada.
+     * @return const GraphemeIndex* Índice correspondente à string, ou nullptr se ela for maior que CACHE_LIMIT.
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
+     */
+    const GraphemeIndex* GraphemeIndex::cached( const std::string& string ) {
+
+        if( !cacheable(string) ) return nullptr;
+
+        thread_local GraphemeIndex index;
+
+        if( index.text.length() != string.length() || index.text != string ) index.assign(string);
+
+        return &index;
+
+    }
+
+    /**
+     * Igual a cached(string), mas sempre retorna um índice: strings maiores que CACHE_LIMIT são indexadas em local,
+     * que não é mantido pela thread. Útil para consultas que precisam de todas as fronteiras (tamanho, slice).
+     *
+     * @note A referência retornada é válida até a próxima chamada de cached na mesma thread, ou enquanto local existir.
+     *
+     * @param string String UTF-8 a ser indexada.
+     * @param local  Índice usado quando a string é grande demais para o cache.
+     * @return const GraphemeIndex& Índice correspondente à string.
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
+     */
+    const GraphemeIndex& GraphemeIndex::cached( const std::string& string, GraphemeIndex& local ) {
+
+        const GraphemeIndex* index = cached(string);
+
+        if(index != nullptr) return *index;
+
+        local.assign(string);
+
+        return local;
+
+    }
+
+    /**
+     * Divide uma string em um vetor de strings usando um separador.
+     * Esta versão trabalha com strings passadas por referência constante.
+     * 
+     * Essa função foi inspirada pela função explode do PHP.
+     * 
+     * Os pedaços são obtidos de forma iterativa por explode_view(), em uma única passada sobre a string,
+     * e só são copiados ao serem adicionados ao vetor. O limit considera também os elementos que o vetor já possui.
+     * 
+     * @param   const std::string& string    String a ser dividida
+     * @param   const std::string& separator        String usada como separador
+     * @param   std::vector<std::string>* reference    Ponteiro para o vetor que armazenará os resultados
+     * @return  void
+     */
+    void explode( const std::string& string, const std::string& separator, std::vector<std::string>* reference, std::size_t limit ) {
+
+        if(limit == 0 || reference->size() >= limit) return;
+
+        for( std::string_view token : forcaStrings::explode_view( string, separator, limit - reference->size() ) ){
+
+            reference->emplace_back(token);
+
+        }
+
+    }
+
+    /**
+     * Divide uma string em um vetor de strings usando um separador.
+     * Esta versão trabalha com strings mutáveis (char*).
+     *
+     * @param   char* string                 String a ser dividida
+     * @param   const std::string& separator        String usada como separador
+     * @param   std::vector<std::string>* reference    Ponteiro para o vetor que armazenará os resultados
+     * @return  void
+     */
+    void explode( char* string, const std::string& separator, std::vector<std::string>* reference, std::size_t limit ) {
+
+        forcaStrings::explode( std::string( string != nullptr ? string : "" ), separator, reference, limit );
+
+    }
+
+    /**
+     * Divide uma string em um vetor de strings usando um separador.
+     * Esta versão trabalha com strings constantes (const char*).
+     * 
+     * @param   const char* string           String a ser dividida
+     * @param   const std::string& separator        String usada como separador
+     * @param   std::vector<std::string>* reference    Ponteiro para o vetor que armazenará os resultados
+     * @return  void
+     */
+    void explode( const char* string, const std::string& separator, std::vector<std::string>* reference, std::size_t limit ) {
+
+        forcaStrings::explode( std::string( string != nullptr ? string : "" ), separator, reference, limit );
+
+    }
+
+    /**
+     * Cria o range de pedaços de uma string, calculando as fronteiras de graphemes quando o separador é vazio.
+     *
+     * @param string    String a ser dividida.
+     * @param separator Separador; vazio divide a string em graphemes.
+     * @param limit     Número máximo de pedaços; o último contém o restante da string.
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
+     */
+    ExplodeRange::ExplodeRange( std::string_view string, std::string_view separator, std::size_t limit ) : text(string), separator(separator), limit(limit) {
+
+        if( separator.empty() && limit != 0 ) graphemes = forcaStrings::graphemeBoundaries(string);
+
+    }
+
+    /**
+     * Posiciona o iterador no primeiro pedaço, ou no fim quando não há nenhum
+     * (limit igual a 0, ou separador vazio com string vazia).
+     */
+    ExplodeRange::iterator::iterator( const ExplodeRange* range ) : range(range), done(false) {
+
+        if( range->limit == 0 || ( range->separator.empty() && range->graphemes.size() < 2 ) ){
+
+            done = true;
+
+            return;
+
+        }
+
+        load(0);
+
+    }
+
+    /**
+     * Calcula o pedaço atual a partir do offset inicial informado. Enquanto o limit permitir, o pedaço termina
+     * no próximo separador (ou no próximo grapheme); o último pedaço permitido vai até o fim da string.
+     */
+    void ExplodeRange::iterator::load( std::string::size_type start ) {
+
+        const ExplodeRange& owner = *range;
+
+        if( owner.separator.empty() ){
+
+            finish = ( index + 1 == owner.limit ) ? owner.text.length() : owner.graphemes[index + 1];
+
+        }
+        else{
+
+            std::string::size_type pos = ( index + 1 < owner.limit ) ? forcaStrings::findLiteral( owner.text, owner.separator, start ) : std::string::npos;
+
+            finish = ( pos == std::string::npos ) ? owner.text.length() : pos;
+
+        }
+
+        token = owner.text.substr( start, finish - start );
+
+    }
+
+    /**
+     * Avança para o próximo pedaço. Um pedaço que termina no fim da string é sempre o último, já que um separador
+     * não vazio encontrado sempre deixa ao menos seu próprio tamanho até o fim.
+     */
+    ExplodeRange::iterator& ExplodeRange::iterator::operator++() {
+
+        if(done) return *this;
+
+        if( finish == range->text.length() ){
+
+            done = true;
+
+            return *this;
+
+        }
+
+        index++;
+
+        load( range->separator.empty() ? finish : finish + range->separator.length() );
+
+        return *this;
+
+    }
+
+    /**
+     * Divide uma string usando um separador, retornando os pedaços como um range preguiçoso de std::string_view.
+     *
+     * Mesma semântica de explode(): com separador vazio a string é dividida em graphemes, e limit é o número
+     * máximo de pedaços, sendo que o último contém o restante da string. Nada é copiado nem recursivo;
+     * cada pedaço é encontrado com findLiteral() quando o iterador avança.
+     *
+     * @param string    String a ser dividida (deve continuar válida enquanto o range for usado).
+     * @param separator String usada como separador.
+     * @param limit     (Opcional) Número máximo de pedaços.
+     * @return ExplodeRange Range com os pedaços.
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU (separador vazio).
+     */
+    ExplodeRange explode_view( std::string_view string, std::string_view separator, std::size_t limit ) {
+
+        return ExplodeRange( string, separator, limit );
+
+    }
+
+    /**
+     * Concatena elementos de um vetor de strings usando um delimitador.
+     * Esta versão trabalha com std::vector<std::string>.
+     * 
+     * Essa função foi inspirada na função implode do PHP.
+     * 
+     * @param   const std::vector<std::string>& array    Vetor de strings a ser concatenado
+     * @param   const std::string& delimiter                    String usada como delimitador
+     * @return  std::string                             String resultante da concatenação
+     */
+    std::string implode( const std::vector<std::string>& array, const std::string& delimiter ) {
+
+        if(array.empty()) return "";
+
+        std::size_t i, length = array.size();
+
+        std::string response = array[0];
+
+        for(i=1; i<length; i++){
+
+            response += delimiter;
+            response += array[i]; 
+
+        }
+
+        return response;
+
+    }
+
+    /**
+     * Concatena elementos de um array de strings usando um delimitador.
+     * Esta versão trabalha com arrays de strings mutáveis (char*).
+     * 
+     * @param   char* array[]               Array de strings a ser concatenado
+     * @param   int size                    Tamanho do array
+     * @param   const std::string& delimiter       String usada como delimitador
+     * @return  std::string                String resultante da concatenação
+     */
+    std::string implode(char* array[], int size, const std::string& delimiter) {
+
+        if (size <= 0 || array == nullptr) return "";
+        
+        std::string response = array[0];
+        
+        for(int i = 1; i < size; i++) {
+
+            if (array[i] == nullptr) break;
+
+            response += delimiter;
+            response += array[i];
+
+        }
+        
+        return response;
+        
+    }
+
+    /**
+     * Concatena elementos de um array de strings usando um delimitador.
+     * Esta versão trabalha com arrays de strings constantes (const char*).
+     * 
+     * @param   const char* array[]         Array de strings a ser concatenado
+     * @param   int size                    Tamanho do array
+     * @param   const std::string& delimiter       String usada como delimitador
+     * @return  std::string                String resultante da concatenação
+     */
+    std::string implode(const char* array[], int size, const std::string& delimiter) {
+
+        if (size <= 0 || array == nullptr) return "";
+        
+        std::string response = array[0];
+        
+        for(int i = 1; i < size; i++) {
+
+            if (array[i] == nullptr) break;
+
+            response += delimiter;
+            response += array[i];
+
+        }
+        
+        return response;
+        
+    }
+
+    /*
+    |=========================================
+    |   FUNÇÕES DE CONVERSÃO UTF-8 / UTF-16
+    |=========================================
+    */
+
+    /**
+     * Verifica se a string é UTF-8 bem formado (sem sequências truncadas, overlong, surrogates ou acima de U+10FFFF).
+     *
+     * Blocos de 16 bytes puramente ASCII são pulados com SSE2, quando disponível; os trechos com bytes não ASCII
+     * são validados com U8_NEXT, que é a mesma decodificação usada pelas versões escalares das conversões de índice.
+     *
+     * @param string String a ser verificada.
+     * @return bool true se a string for UTF-8 válido.
+     */
+    bool isValidUTF8( std::string_view string ) {
+
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>( string.data() );
+
+        std::size_t length = string.length();
+
+        std::size_t i = 0;
+
+        while( i < length ){
+
+#ifdef FORCA_STRINGS_SSE2
+
+            if( i + 16 <= length && _mm_movemask_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>(bytes + i) ) ) == 0 ){
+
+                i += 16;
+
+                continue;
+
+            }
+
+#endif
+
+            if( bytes[i] < 0x80 ){
+
+                i++;
+
+                continue;
+
+            }
+
+            UChar32 c;
+
+            U8_NEXT(bytes, i, length, c);
+
+            if( c < 0 ) return false;
+
+        }
+
+        return true;
+
+    }
+
+#ifdef FORCA_STRINGS_SSE2
+
+    /**
+     * Calcula, para cada um dos 16 bytes do bloco, quantas unidades UTF-16 ele inicia: 0 para bytes de
+     * continuação (0x80 a 0xBF), 2 para bytes iniciais de 4 bytes (0xF0 a 0xFF) e 1 para os demais.
+     * As comparações do SSE2 são com sinal, então 0x80 a 0xBF são os valores menores que -64
+     * e 0xF0 a 0xFF são os valores entre -16 e -1.
+     */
+    static inline __m128i utf16UnitsPerByte( __m128i block ) {
+
+        const __m128i zero = _mm_setzero_si128();
+
+        __m128i continuation = _mm_cmplt_epi8( block, _mm_set1_epi8(-64) );
+
+        __m128i fourBytesLead = _mm_and_si128( _mm_cmpgt_epi8( block, _mm_set1_epi8(-17) ), _mm_cmplt_epi8(block, zero) );
+
+        return _mm_sub_epi8( _mm_add_epi8( _mm_set1_epi8(1), continuation ), fourBytesLead );
+
+    }
+
+    /**
+     * Soma horizontal dos 16 bytes de um vetor (cada byte sem sinal).
+     */
+    static inline std::size_t sumBytes( __m128i vector ) {
+
+        __m128i sums = _mm_sad_epu8( vector, _mm_setzero_si128() );
+
+        return static_cast<std::size_t>( _mm_cvtsi128_si32(sums) ) + static_cast<std::size_t>( _mm_cvtsi128_si32( _mm_unpackhi_epi64(sums, sums) ) );
+
+    }
+
+#endif
+
+    /**
+     * Conta quantas unidades UTF-16 um trecho UTF-8 bem formado ocupa: um por caractere, dois para os
+     * caracteres fora do BMP (bytes iniciais de 4 bytes).
+     *
+     * Com SSE2, cada bloco de 16 bytes é classificado de uma vez e as contagens são acumuladas em bytes
+     * por até 127 blocos (no máximo 2 por byte, sem estourar 255) antes de serem somadas com _mm_sad_epu8.
+     *
+     * @param string Trecho UTF-8 (assumido válido; veja isValidUTF8).
+     * @return std::string::size_type Quantidade de unidades UTF-16.
+     */
+    std::string::size_type countUTF16( std::string_view string ) {
+
+        const unsigned char* data = reinterpret_cast<const unsigned char*>( string.data() );
+
+        std::size_t length = string.length();
+
+        std::string::size_type units = 0;
+
+        std::size_t i = 0;
+
+#ifdef FORCA_STRINGS_SSE2
+
+        while( i + 16 <= length ){
+
+            __m128i accumulator = _mm_setzero_si128();
+
+            std::size_t blocks;
+
+            for( blocks = 0; i + 16 <= length && blocks < 127; i += 16, blocks++ ){
+
+                accumulator = _mm_add_epi8( accumulator, utf16UnitsPerByte( _mm_loadu_si128( reinterpret_cast<const __m128i*>(data + i) ) ) );
+
+            }
+
+            units += sumBytes(accumulator);
+
+        }
+
+#endif
+
+        for(; i < length; i++ ){
+
+            unsigned char byte = data[i];
+
+            units += ( (byte & 0xC0) != 0x80 ) + ( byte >= 0xF0 );
+
+        }
+
+        return units;
+
+    }
+
+    /**
+     * Retorna o offset em bytes do caractere que começa na unidade UTF-16 informada, em um trecho UTF-8 bem formado.
+     *
+     * Os blocos de 16 bytes que terminam antes do alvo são pulados somando suas unidades com SSE2; o bloco onde
+     * o alvo está é percorrido byte a byte. Se o alvo cair no meio de um par surrogate, o offset retornado
+     * é o início do caractere de 4 bytes correspondente.
+     *
+     * @param string Trecho UTF-8 (assumido válido; veja isValidUTF8).
+     * @param target Índice UTF-16 alvo.
+     * @return std::string::size_type Offset em bytes, ou std::string::npos se o alvo for maior que o tamanho em UTF-16.
+     */
+    static std::string::size_type offsetOfUTF16( std::string_view string, std::string::size_type target ) {
+
+        const unsigned char* data = reinterpret_cast<const unsigned char*>( string.data() );
+
+        std::size_t length = string.length();
+
+        std::string::size_type units = 0;
+
+        std::size_t i = 0;
+
+#ifdef FORCA_STRINGS_SSE2
+
+        while( i + 16 <= length ){
+
+            std::size_t blockUnits = sumBytes( utf16UnitsPerByte( _mm_loadu_si128( reinterpret_cast<const __m128i*>(data + i) ) ) );
+
+            if( units + blockUnits >= target ) break;
+
+            units += blockUnits;
+
+            i += 16;
+
+        }
+
+#endif
+
+        for(; i < length; i++ ){
+
+            unsigned char byte = data[i];
+
+            if( (byte & 0xC0) == 0x80 ) continue;
+
+            std::string::size_type next = units + 1 + ( byte >= 0xF0 );
+
+            if( units == target || next > target ) return i;
+
+            units = next;
+
+        }
+
+        return ( units == target ) ? length : std::string::npos;
+
+    }
+
+    /**
+     * Converte um índice baseado em unidades de código UTF-16 (padrão JS)
+     * para um índice baseado em bytes (padrão C++ std::string/UTF-8).
+     *
+     * @param utf8_string A string de contexto completa, em formato UTF-8.
+     * @param utf16_index_alvo O índice no formato JavaScript a ser convertido.
+     * @return O offset correspondente em bytes.
+     * @throws std::out_of_range se o utf16_index_alvo for inválido.
+     */
+    std::string::size_type IndexUTF16_toUTF8( const std::string& utf8_string, std::string::size_type utf16_index_alvo ) {
+
+        if (utf16_index_alvo == 0) {
+            return 0;
+        }
+
+        if( forcaStrings::isValidUTF8(utf8_string) ){
+
+            std::string::size_type offset = forcaStrings::offsetOfUTF16(utf8_string, utf16_index_alvo);
+
+            if (offset == std::string::npos) {
+                throw std::out_of_range("Índice UTF-16 alvo está fora dos limites da string.");
+            }
+
+            return offset;
+
+        }
+
+        // UTF-8 inválido: as sequências inválidas viram U+FFFD, então a conversão passa pela ICU.
+        icu::UnicodeString u_str = icu::UnicodeString::fromUTF8(utf8_string);
+
+        if (utf16_index_alvo > u_str.length()) {
+            throw std::out_of_range("Índice UTF-16 alvo está fora dos limites da string.");
+        }
+
+        icu::UnicodeString prefixo_u16;
+
+        u_str.extract(0, utf16_index_alvo, prefixo_u16);
+
+        std::string prefixo_utf8;
+
+        prefixo_u16.toUTF8String(prefixo_utf8);
+
+        return prefixo_utf8.length();
+
+    }    
+
+    /**
+     * Converte um único índice baseado em bytes (UTF-8) para um índice
+     * baseado em unidades de código UTF-16 (compatível com JavaScript) de forma otimizada.
+     * A função itera pela string apenas o necessário para fazer a conversão.
+     *
+     * @param utf8_string A string original no formato UTF-8.
+     * @param byte_index_alvo O índice baseado em bytes a ser convertido.
+     * @return O índice correspondente em unidades de código UTF-16.
+     * @throws std::out_of_range se o byte_index_alvo for maior que o tamanho da string.
+     */
+    std::string::size_type IndexUTF8_toUTF16( const std::string& utf8_string, std::string::size_type byte_index_alvo ) {
+
+        if (byte_index_alvo > utf8_string.length()) {
+            throw std::out_of_range("Índice de byte alvo está fora dos limites da string.");
+        }
+
+        if (byte_index_alvo == 0) {
+            return 0;
+        }
+
+        std::string_view prefix( utf8_string.data(), byte_index_alvo );
+
+        if( forcaStrings::isValidUTF8(prefix) ) return forcaStrings::countUTF16(prefix);
+
+        std::string::size_type utf8_pos = 0;
+        std::string::size_type utf16_pos = 0;
+
+        const char* s = utf8_string.c_str();
+        std::string::size_type len_bytes = utf8_string.length();
+
+        while (utf8_pos < byte_index_alvo) {
+
+            UChar32 c;
+
+            U8_NEXT(s, utf8_pos, len_bytes, c);
+
+            utf16_pos += U16_LENGTH(c);
+
+        }
+
+        return utf16_pos;
+
+    }
+
+    /**
+     * Cria um mapa de conversão de índices de byte (UTF-8) para índices de 
+     * unidades de código (UTF-16).
+     * 
+     * Itera sobre a string uma única vez para máxima eficiência.
+     *
+     * @param utf8_string A string de entrada.
+     * @return Um vetor onde `mapa[byte_index]` retorna o `utf16_index` correspondente.
+     */
+    std::vector<std::string::size_type> MapIndexUTF8_toUTF16( const std::string& utf8_string ) {
+
+        std::string::size_type len_bytes = utf8_string.length();
+        
+        std::vector<std::string::size_type> mapa(len_bytes + 1);
+
+        std::string::size_type utf8_pos = 0;
+        std::string::size_type utf16_pos = 0;
+
+        while (utf8_pos < len_bytes) {
+           
+            std::string::size_type inicio_char_utf8 = utf8_pos;
+
+            UChar32 c;
+
+            U8_NEXT(utf8_string.c_str(), utf8_pos, len_bytes, c);
+
+            std::string::size_type bytes_neste_char = utf8_pos - inicio_char_utf8;
+          
+            std::string::size_type u16_neste_char = U16_LENGTH(c);
+
+            for (int i = 0; i < bytes_neste_char; ++i) {
+                mapa[inicio_char_utf8 + i] = utf16_pos;
+            }
+
+            utf16_pos += u16_neste_char;
+        }
+
+        mapa[len_bytes] = utf16_pos;
+
+        return mapa;
+
+    }
+
+    /**
+     * Converte um offset em bytes para o índice UTF-16 correspondente, continuando a partir da consulta anterior.
+     *
+     * Se o offset for menor que o da consulta anterior, a contagem recomeça do início da string.
+     * Trechos UTF-8 válidos são contados com countUTF16; trechos inválidos são decodificados com U8_NEXT,
+     * com o mesmo resultado de IndexUTF8_toUTF16.
+     *
+     * @param byteOffset Offset em bytes na string.
+     * @return std::string::size_type Índice correspondente em unidades UTF-16.
+     * @throws std::out_of_range se o offset for maior que o tamanho da string.
+     */
+    std::string::size_type UTF16OffsetCursor::toUTF16( std::string::size_type byteOffset ) {
+
+        if (byteOffset > text.length()) {
+            throw std::out_of_range("Índice de byte alvo está fora dos limites da string.");
+        }
+
+        if( byteOffset < byte ){
+
+            byte = 0;
+
+            units = 0;
+
+        }
+
+        std::string_view segment = text.substr( byte, byteOffset - byte );
+
+        if( forcaStrings::isValidUTF8(segment) ){
+
+            units += forcaStrings::countUTF16(segment);
+
+            byte = byteOffset;
+
+            return units;
+
+        }
+
+        /*
+            Trecho inválido (ou terminando no meio de um caractere): decodifica como IndexUTF8_toUTF16, podendo
+            avançar além do offset pedido para completar o último caractere. A posição real alcançada é guardada.
+        */
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>( text.data() );
+
+        std::size_t i = byte;
+
+        while( i < byteOffset ){
+
+            UChar32 c;
+
+            U8_NEXT(bytes, i, text.length(), c);
+
+            units += U16_LENGTH(c);
+
+        }
+
+        byte = i;
+
+        return units;
+
+    }
+
+    /*
+    |=============================
+    |   FUNÇÕES DE BUSCA LITERAL
+    |=============================
+    */
+
+#ifdef FORCA_STRINGS_SSE2
+
+    /**
+     * Retorna a posição do bit menos significativo ligado (a máscara nunca é zero).
+     */
+    static inline unsigned int lowestBit( unsigned int mask ) {
+
+        #if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return static_cast<unsigned int>(index);
+        #else
+            return static_cast<unsigned int>( __builtin_ctz(mask) );
+        #endif
+
+    }
+
+#endif
+
+    /**
+     * Busca uma substring literal (sem regex) a partir de um offset em bytes.
+     *
+     * Para agulhas de um byte usa o memchr. Para as demais, compara o primeiro e o último byte da agulha
+     * em blocos de 16 posições com SSE2 e só verifica (memcmp) as posições em que os dois batem.
+     * Sem SSE2 usa o memchr para achar os candidatos pelo primeiro byte.
+     * Como a busca é byte a byte em UTF-8 válido, um match nunca começa no meio de um caractere.
+     *
+     * @param string  String onde será feita a busca.
+     * @param search  Texto literal a ser buscado.
+     * @param offset  (Opcional) Posição em bytes onde iniciar a busca.
+     * @return std::string::size_type Posição em bytes da ocorrência, ou std::string::npos se não encontrada.
+     */
+    std::string::size_type findLiteral( std::string_view string, std::string_view search, std::string::size_type offset ) {
+
+        const std::size_t length = string.length();
+        const std::size_t searchLength = search.length();
+
+        if( offset > length ) return std::string::npos;
+
+        if( searchLength == 0 ) return offset;
+
+        if( searchLength > length - offset ) return std::string::npos;
+
+        const char* data = string.data();
+        const char* needle = search.data();
+
+        if( searchLength == 1 ){
+
+            const void* found = std::memchr( data + offset, needle[0], length - offset );
+
+            return found == nullptr ? std::string::npos : static_cast<const char*>(found) - data;
+
+        }
+
+        const std::size_t lastStart = length - searchLength; // Última posição onde a agulha ainda cabe.
+
+        std::size_t i = offset;
+
+#ifdef FORCA_STRINGS_SSE2
+
+        const __m128i first = _mm_set1_epi8( needle[0] );
+        const __m128i last = _mm_set1_epi8( needle[searchLength - 1] );
+
+        while( i + 15 <= lastStart ){
+
+            __m128i blockFirst = _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + i ) );
+            __m128i blockLast = _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + i + searchLength - 1 ) );
+
+            unsigned int mask = static_cast<unsigned int>( _mm_movemask_epi8( _mm_and_si128( _mm_cmpeq_epi8(first, blockFirst), _mm_cmpeq_epi8(last, blockLast) ) ) );
+
+            while( mask != 0 ){
+
+                std::size_t candidate = i + lowestBit(mask);
+
+                if( std::memcmp( data + candidate + 1, needle + 1, searchLength - 2 ) == 0 ) return candidate;
+
+                mask &= mask - 1;
+
+            }
+
+            i += 16;
+
+        }
+
+#endif
+
+        while( i <= lastStart ){
+
+            const void* found = std::memchr( data + i, needle[0], lastStart - i + 1 );
+
+            if( found == nullptr ) return std::string::npos;
+
+            i = static_cast<const char*>(found) - data;
+
+            if( data[i + searchLength - 1] == needle[searchLength - 1] && std::memcmp( data + i + 1, needle + 1, searchLength - 2 ) == 0 ) return i;
+
+            i++;
+
+        }
+
+        return std::string::npos;
+
+    }
+
+    /**
+     * Verifica se um padrão no formato /pattern/flags é, na prática, um texto literal:
+     * sem flags e sem nenhum metacaractere de regex. Nesse caso a busca pode ser feita
+     * com findLiteral(), sem compilar nem executar o PCRE2.
+     *
+     * @param pattern  Padrão regex no formato /pattern/flags (ou #pattern#flags).
+     * @param literal  (Opcional) Recebe o texto literal do padrão.
+     * @return bool    true se o padrão puder ser buscado como texto literal.
+     */
+    bool isLiteralPattern( const std::string& pattern, std::string* literal ) {
+
+        std::size_t length = pattern.length();
+
+        if( length < 3 ) return false;
+
+        char delimiter = pattern[0];
+
+        // Sem flags: o delimitador final precisa ser o último caractere.
+        if( ( delimiter != '/' && delimiter != '#' ) || pattern[length - 1] != delimiter ) return false;
+
+        static const char metacharacters[] = "\\^$.|?*+()[]{}";
+
+        for( std::size_t i = 1; i < length - 1; i++ ){
+
+            char c = pattern[i];
+
+            if( c == delimiter || std::strchr(metacharacters, c) != nullptr ) return false;
+
+        }
+
+        if( literal != nullptr ) literal->assign( pattern, 1, length - 2 );
+
+        return true;
+
+    }
+
+    /**
+     * Retorna o índice da primeira ocorrência do padrão informado na string.
+     *
+     * Esta função busca a primeira ocorrência do padrão (string ou expressão regular) na string de entrada,
+     * retornando o índice correspondente em unidades UTF-16 (compatível com JavaScript).
+     * Inspirada na função search do JavaScript.
+     *
+     * Padrões sem flags e sem metacaracteres (ex: "/a/") e buscas com literal = true
+     * são feitos com findLiteral(), sem passar pelo PCRE2.
+     *
+     * @param string  String onde será feita a busca.
+     * @param search  Padrão a ser buscado (string ou expressão regular).
+     * @param literal (Opcional) Se true, search é tratado como texto literal, e não como regex.
+     * @return std::string::size_type Índice da primeira ocorrência do padrão, ou std::string::npos se não encontrado.
+     */    
+    std::string::size_type search( const std::string& string, const std::string& search, bool literal ) {
+
+        if(string.empty()) return std::string::npos;
+
+        std::string literalSearch;
+
+        if( literal || forcaStrings::isLiteralPattern(search, &literalSearch) ){
+
+            std::string::size_type position = forcaStrings::findLiteral( string, literal ? search : literalSearch );
+
+            if(position == std::string::npos) return std::string::npos;
+
+            return forcaStrings::countUTF16( std::string_view( string.data(), position ) );
+
+        }
+
+        // Só os offsets são necessários, então nenhuma captura é copiada.
+        forcaRegex::RegexMatches result = forcaRegex::preg_match_offsets(search, string);
+
+        if(!result.match) return std::string::npos;
+
+        std::string::size_type index = forcaStrings::IndexUTF8_toUTF16(string, result.start(0));
+
+        return index;
+
+    }
+
+    /**
+     * Retorna os índices de todas as ocorrências do padrão informado na string.
+     *
+     * Esta função busca todas as ocorrências do padrão (string ou expressão regular) na string de entrada,
+     * retornando um vetor com os índices de cada ocorrência em unidades UTF-16 (compatível com JavaScript).
+     * 
+     * Inspirada na função search do JavaScript, porém searchAll é uma implementação pessoal e não existe nativamente no JS.
+     *
+     * Padrões sem flags e sem metacaracteres (ex: "/a/") e buscas com literal = true
+     * são feitos com findLiteral(), sem passar pelo PCRE2. Assim como no regex, as ocorrências
+     * não se sobrepõem, e um texto literal vazio não retorna nenhum índice.
+     *
+     * @param string  String onde será feita a busca.
+     * @param search  Padrão a ser buscado (string ou expressão regular).
+     * @param limit   (Opcional) Limite máximo de índices a retornar.
+     * @param literal (Opcional) Se true, search é tratado como texto literal, e não como regex.
+     * @return std::vector<std::string::size_type> Vetor com os índices de todas as ocorrências encontradas.
+     */    
+    std::vector<std::string::size_type> search_all( const std::string& string, const std::string& search, std::size_t limit, bool literal ) {
+
+        if(string.empty() || limit == 0) return {};
+
+        std::string literalSearch;
+
+        if( literal || forcaStrings::isLiteralPattern(search, &literalSearch) ){
+
+            const std::string& needle = literal ? search : literalSearch;
+
+            if( needle.empty() ) return {};
+
+            std::vector<std::string::size_type> all_index;
+
+            std::string::size_type position = forcaStrings::findLiteral(string, needle);
+
+            // Converte os offsets para UTF-16 de forma incremental, contando só o trecho desde o último match.
+            forcaStrings::UTF16OffsetCursor cursor(string);
+
+            while( position != std::string::npos && all_index.size() < limit ){
+
+                all_index.push_back( cursor.toUTF16(position) );
+
+                position = forcaStrings::findLiteral( string, needle, position + needle.length() );
+
+            }
+
+            return all_index;
+
+        }
+
+        // Só os offsets são necessários, então nenhuma captura é copiada.
+        forcaRegex::RegexMatches result = forcaRegex::preg_match_all_offsets(search, string, 0, limit);
+
+        if(!result.match) return {};
+
+        std::vector<std::string::size_type> all_index;
+
+        std::size_t i, matchSize = result.size();
+
+        all_index.reserve(matchSize);
+
+        /*
+            Os matches vêm em ordem crescente, então o cursor só percorre a string até o último deles,
+            sem montar um mapa de índices para cada byte.
+        */
+        forcaStrings::UTF16OffsetCursor cursor(string);
+
+        for(i=0; i<matchSize; i++){
+
+            all_index.push_back( cursor.toUTF16( result.start(0, i) ) );
+
+        }
+
+        return all_index;
+
+    }
+
+    /*
+    |=========================================
+    |   FUNÇÕES DE DISTÂNCIA DE EDIÇÃO
+    |=========================================
+    */
+
+    /**
+     * Decodifica uma string UTF-8 em code points. Sequências inválidas viram U_SENTINEL (-1),
+     * que é tratado como um símbolo comum nas comparações.
+     */
+    static std::vector<UChar32> decodeCodePoints( std::string_view string ) {
+
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>( string.data() );
+
+        std::vector<UChar32> codePoints;
+
+        codePoints.reserve( string.length() );
+
+        std::size_t i = 0;
+
+        while( i < string.length() ){
+
+            UChar32 c;
+
+            U8_NEXT(bytes, i, string.length(), c);
+
+            codePoints.push_back(c);
+
+        }
+
+        return codePoints;
+
+    }
+
+    /**
+     * Conta os code points de uma string UTF-8, com a mesma decodificação de decodeCodePoints().
+     */
+    static std::size_t countCodePoints( std::string_view string ) {
+
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>( string.data() );
+
+        std::size_t count = 0, i = 0;
+
+        while( i < string.length() ){
+
+            if( bytes[i] < 0x80 ){
+
+                i++;
+
+            }
+            else{
+
+                UChar32 c;
+
+                U8_NEXT(bytes, i, string.length(), c);
+
+            }
+
+            count++;
+
+        }
+
+        return count;
+
+    }
+
+    /**
+     * Verifica se a distância parcial já não pode mais ficar dentro do limite: cada code point restante
+     * do texto reduz a distância em no máximo 1.
+     */
+    static inline bool exceedsDistance( std::size_t score, std::size_t remaining, std::size_t maxDistance ) {
+
+        return score > remaining && ( score - remaining ) > maxDistance;
+
+    }
+
+    /**
+     * Padrão pré-processado para o algoritmo bit-paralelo de Myers (na formulação de Hyyrö para distância global),
+     * válido para padrões de até 64 code points.
+     *
+     * Para cada code point do padrão é guardada uma máscara de 64 bits com as posições em que ele aparece.
+     * Code points ASCII usam uma tabela direta; os demais ficam em um vetor ordenado, consultado por busca binária.
+     * Cada code point do texto é então processado em O(1) operações de bits, em vez de uma coluna inteira da matriz.
+     */
+    class MyersPattern {
+
+        public:
+
+            explicit MyersPattern( const std::vector<UChar32>& pattern ) : length( pattern.size() ) {
+
+                std::size_t i;
+
+                for(i = 0; i < length; i++){
+
+                    UChar32 c = pattern[i];
+
+                    std::uint64_t bit = std::uint64_t(1) << i;
+
+                    if( c >= 0 && c < 0x80 ){
+
+                        ascii[c] |= bit;
+
+                        continue;
+
+                    }
+
+                    auto it = std::lower_bound( others.begin(), others.end(), c, []( const std::pair<UChar32, std::uint64_t>& entry, UChar32 value ){ return entry.first < value; } );
+
+                    if( it != others.end() && it->first == c ) it->second |= bit;
+                    else others.insert( it, { c, bit } );
+
+                }
+
+            }
+
+            /**
+             * Calcula a distância de Levenshtein entre o padrão e o texto.
+             *
+             * @param text          Texto UTF-8.
+             * @param textLength    Quantidade de code points do texto.
+             * @param maxDistance   Distância máxima de interesse; o cálculo é interrompido assim que ela não pode mais ser atingida.
+             * @return std::size_t  Distância, ou maxDistance + 1 quando ela com certeza é maior que maxDistance.
+             */
+            std::size_t distance( std::string_view text, std::size_t textLength, std::size_t maxDistance ) const {
+
+                if( length == 0 ) return textLength;
+
+                const uint8_t* bytes = reinterpret_cast<const uint8_t*>( text.data() );
+
+                const std::uint64_t last = std::uint64_t(1) << (length - 1);
+
+                std::uint64_t pv = ~std::uint64_t(0), mv = 0;
+
+                std::size_t score = length, processed = 0, i = 0;
+
+                while( i < text.length() ){
+
+                    UChar32 c;
+
+                    U8_NEXT(bytes, i, text.length(), c);
 
-        std::string response = array[0];
+                    std::uint64_t eq = mask(c);
 
-        for(i=1; i<length; i++){
+                    std::uint64_t xv = eq | mv;
 
-            response += delimiter;
-            response += array[i]; 
+                    std::uint64_t xh = ( ( (eq & pv) + pv ) ^ pv ) | eq;
 
-        }
+                    std::uint64_t ph = mv | ~(xh | pv);
 
-        return response;
+                    std::uint64_t mh = pv & xh;
 
-    }
+                    if( ph & last ) score++;
+                    else if( mh & last ) score--;
 
-    /**
-     * Concatena elementos de um array de strings usando um delimitador.
-     * Esta versão trabalha com arrays de strings mutáveis (char*).
-     * 
-     * @param   char* array[]               Array de strings a ser concatenado
-     * @param   int size                    Tamanho do array
-     * @param   const std::string& delimiter       String usada como delimitador
-     * @return  std::string                String resultante da concatenação
-     */
-    std::string implode(char* array[], int size, const std::string& delimiter) {
+                    // A primeira linha da matriz é D[0][j] = j, então a diferença horizontal que entra por baixo é sempre +1.
+                    ph = (ph << 1) | 1;
 
-        if (size <= 0 || array == nullptr) return "";
-        
-        std::string response = array[0];
-        
-        for(int i = 1; i < size; i++) {
+                    mh <<= 1;
 
-            if (array[i] == nullptr) break;
+                    pv = mh | ~(xv | ph);
 
-            response += delimiter;
-            response += array[i];
+                    mv = ph & xv;
 
-        }
-        
-        return response;
-        
-    }
+                    processed++;
+
+                    if( exceedsDistance( score, textLength - processed, maxDistance ) ) return maxDistance + 1;
+
+                }
+
+                return score;
+
+            }
+
+        private:
+
+            std::uint64_t mask( UChar32 c ) const {
+
+                if( c >= 0 && c < 0x80 ) return ascii[c];
+
+                auto it = std::lower_bound( others.begin(), others.end(), c, []( const std::pair<UChar32, std::uint64_t>& entry, UChar32 value ){ return entry.first < value; } );
+
+                return ( it != others.end() && it->first == c ) ? it->second : 0;
+
+            }
+
+            std::size_t length;
+
+            std::uint64_t ascii[128] = {};
+
+            std::vector< std::pair<UChar32, std::uint64_t> > others;
+
+    };
 
     /**
-     * Concatena elementos de um array de strings usando um delimitador.
-     * Esta versão trabalha com arrays de strings constantes (const char*).
-     * 
-     * @param   const char* array[]         Array de strings a ser concatenado
-     * @param   int size                    Tamanho do array
-     * @param   const std::string& delimiter       String usada como delimitador
-     * @return  std::string                String resultante da concatenação
+     * Distância de Levenshtein por programação dinâmica com duas linhas, usada quando o padrão tem mais de 64 code points.
+     * O cálculo é interrompido quando o menor valor de uma linha já passa de maxDistance.
+     *
+     * @return std::size_t Distância, ou maxDistance + 1 quando ela com certeza é maior que maxDistance.
      */
-    std::string implode(const char* array[], int size, const std::string& delimiter) {
+    static std::size_t levenshteinFallback( const std::vector<UChar32>& pattern, const std::vector<UChar32>& text, std::size_t maxDistance ) {
 
-        if (size <= 0 || array == nullptr) return "";
-        
-        std::string response = array[0];
-        
-        for(int i = 1; i < size; i++) {
+        std::vector<std::size_t> previous( pattern.size() + 1 ), current( pattern.size() + 1 );
 
-            if (array[i] == nullptr) break;
+        std::size_t i, j;
 
-            response += delimiter;
-            response += array[i];
+        for(i = 0; i <= pattern.size(); i++) previous[i] = i;
+
+        for(j = 1; j <= text.size(); j++){
+
+            current[0] = j;
+
+            std::size_t rowMinimum = current[0];
+
+            for(i = 1; i <= pattern.size(); i++){
+
+                std::size_t substitution = previous[i - 1] + ( pattern[i - 1] != text[j - 1] );
+
+                current[i] = std::min( { previous[i] + 1, current[i - 1] + 1, substitution } );
+
+                rowMinimum = std::min( rowMinimum, current[i] );
+
+            }
+
+            if( rowMinimum > maxDistance ) return maxDistance + 1;
+
+            previous.swap(current);
 
         }
-        
-        return response;
-        
+
+        return previous[ pattern.size() ];
+
     }
 
     /**
-     * Converte um índice baseado em unidades de código UTF-16 (padrão JS)
-     * para um índice baseado em bytes (padrão C++ std::string/UTF-8).
+     * Calcula a distância de edição (Levenshtein) entre duas strings, contando inserções, remoções e
+     * substituições de code points Unicode (e não de bytes).
      *
-     * @param utf8_string A string de contexto completa, em formato UTF-8.
-     * @param utf16_index_alvo O índice no formato JavaScript a ser convertido.
-     * @return O offset correspondente em bytes.
-     * @throws std::out_of_range se o utf16_index_alvo for inválido.
+     * Quando a menor das duas strings tem até 64 code points, usa o algoritmo bit-paralelo de Myers,
+     * que processa cada code point da outra string em tempo constante. Strings maiores usam programação dinâmica.
+     *
+     * @param first  Primeira string (UTF-8).
+     * @param second Segunda string (UTF-8).
+     * @return std::size_t Distância de edição entre as duas strings.
      */
-    std::string::size_type IndexUTF16_toUTF8( const std::string& utf8_string, std::string::size_type utf16_index_alvo ) {
+    std::size_t levenshtein( std::string_view first, std::string_view second ) {
 
-        icu::UnicodeString u_str = icu::UnicodeString::fromUTF8(utf8_string);
+        std::vector<UChar32> a = decodeCodePoints(first);
 
-        if (utf16_index_alvo > u_str.length()) {
-            throw std::out_of_range("Índice UTF-16 alvo está fora dos limites da string.");
-        }
-        if (utf16_index_alvo == 0) {
-            return 0;
-        }
+        std::size_t secondLength = countCodePoints(second);
 
-        icu::UnicodeString prefixo_u16;
+        if( a.size() > secondLength ){
 
-        u_str.extract(0, utf16_index_alvo, prefixo_u16);
+            std::swap(first, second);
 
-        std::string prefixo_utf8;
+            a = decodeCodePoints(first);
 
-        prefixo_u16.toUTF8String(prefixo_utf8);
+            secondLength = countCodePoints(second);
 
-        return prefixo_utf8.length();
+        }
 
-    }    
+        const std::size_t unlimited = std::numeric_limits<std::size_t>::max() - 1;
+
+        if( a.size() <= 64 ) return MyersPattern(a).distance( second, secondLength, unlimited );
+
+        return levenshteinFallback( a, decodeCodePoints(second), unlimited );
+
+    }
 
     /**
-     * Converte um único índice baseado em bytes (UTF-8) para um índice
-     * baseado em unidades de código UTF-16 (compatível com JavaScript) de forma otimizada.
-     * A função itera pela string apenas o necessário para fazer a conversão.
+     * Procura, em um dicionário, as palavras cuja distância de edição até a consulta é no máximo maxDistance.
      *
-     * @param utf8_string A string original no formato UTF-8.
-     * @param byte_index_alvo O índice baseado em bytes a ser convertido.
-     * @return O índice correspondente em unidades de código UTF-16.
-     * @throws std::out_of_range se o byte_index_alvo for maior que o tamanho da string.
+     * A consulta é pré-processada uma única vez (Myers, até 64 code points) e comparada com cada palavra do dicionário.
+     * Palavras cuja diferença de tamanho já é maior que maxDistance são descartadas sem calcular a distância,
+     * e o cálculo de cada palavra é interrompido assim que o limite não pode mais ser atingido.
+     * Útil para avisar sobre palavras quase duplicadas (ex: "CACHORRO" e "CAHORRO"); as palavras são comparadas
+     * como estão, então consulta e dicionário devem estar normalizados da mesma forma (ver normalizeWord()).
+     *
+     * @param query       Palavra consultada (UTF-8).
+     * @param dictionary  Palavras do dicionário.
+     * @param maxDistance Distância máxima para uma palavra ser considerada parecida.
+     * @return std::vector<DistanceMatch> Índice no dicionário e distância de cada palavra parecida,
+     *                                    ordenados pela distância (e pelo índice, em caso de empate).
      */
-    std::string::size_type IndexUTF8_toUTF16( const std::string& utf8_string, std::string::size_type byte_index_alvo ) {
+    std::vector<DistanceMatch> similarWords( std::string_view query, const std::vector<std::string>& dictionary, std::size_t maxDistance ) {
 
-        if (byte_index_alvo > utf8_string.length()) {
-            throw std::out_of_range("Índice de byte alvo está fora dos limites da string.");
-        }
+        std::vector<UChar32> pattern = decodeCodePoints(query);
 
-        if (byte_index_alvo == 0) {
-            return 0;
-        }
+        std::size_t queryLength = pattern.size();
 
-        std::string::size_type utf8_pos = 0;
-        std::string::size_type utf16_pos = 0;
+        std::unique_ptr<MyersPattern> myers;
 
-        const char* s = utf8_string.c_str();
-        std::string::size_type len_bytes = utf8_string.length();
+        if( queryLength <= 64 ) myers = std::make_unique<MyersPattern>(pattern);
 
-        while (utf8_pos < byte_index_alvo) {
+        std::vector<DistanceMatch> matches;
 
-            UChar32 c;
+        std::size_t i, dictionarySize = dictionary.size();
 
-            U8_NEXT(s, utf8_pos, len_bytes, c);
+        /*
+            Nenhuma distância passa do tamanho da consulta mais o da maior palavra (em bytes, que é um limite superior
+            para os code points). Limitar maxDistance a isso evita que o sentinela maxDistance + 1 dê a volta para 0.
+        */
+        std::size_t distanceBound = query.length();
 
-            utf16_pos += U16_LENGTH(c);
+        for(const std::string& word : dictionary) distanceBound = std::max( distanceBound, query.length() + word.length() );
+
+        maxDistance = std::min( maxDistance, distanceBound );
+
+        for(i = 0; i < dictionarySize; i++){
+
+            const std::string& word = dictionary[i];
+
+            std::size_t wordLength = countCodePoints(word);
+
+            std::size_t lengthDifference = ( wordLength > queryLength ) ? wordLength - queryLength : queryLength - wordLength;
+
+            if( lengthDifference > maxDistance ) continue;
+
+            std::size_t distance = myers ? myers->distance( word, wordLength, maxDistance ) : levenshteinFallback( pattern, decodeCodePoints(word), maxDistance );
+
+            if( distance <= maxDistance ) matches.push_back( { i, distance } );
 
         }
 
-        return utf16_pos;
+        std::stable_sort( matches.begin(), matches.end(), []( const DistanceMatch& a, const DistanceMatch& b ){ return a.distance < b.distance; } );
+
+        return matches;
 
     }
 
+    /* 
+    |=========================================
+    |   FUNÇÕES DE ORDENAÇÃO (COLLATION)
+    |========================================= 
+    */
+
     /**
-     * Cria um mapa de conversão de índices de byte (UTF-8) para índices de 
-     * unidades de código (UTF-16).
-     * 
-     * Itera sobre a string uma única vez para máxima eficiência.
+     * Quantidade mínima de palavras para que a ordenação das chaves seja dividida entre várias threads.
+     * Abaixo disso o custo de criar as threads supera o ganho.
+     */
+    static constexpr std::size_t COLLATION_PARALLEL_THRESHOLD = 1 << 15;
+
+    /**
+     * Retorna o Collator pt-BR da thread atual.
      *
-     * @param utf8_string A string de entrada.
-     * @return Um vetor onde `mapa[byte_index]` retorna o `utf16_index` correspondente.
+     * O Collator é criado uma única vez por thread e reaproveitado entre as chamadas, evitando carregar
+     * as regras de ordenação da ICU a cada uso.
+     *
+     * @return icu::Collator& Collator com as regras do português do Brasil.
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
      */
-    std::vector<std::string::size_type> MapIndexUTF8_toUTF16( const std::string& utf8_string ) {
+    static icu::Collator& collator() {
 
-        std::string::size_type len_bytes = utf8_string.length();
-        
-        std::vector<std::string::size_type> mapa(len_bytes + 1);
+        thread_local std::unique_ptr<icu::Collator> instance;
 
-        std::string::size_type utf8_pos = 0;
-        std::string::size_type utf16_pos = 0;
+        if( !instance ){
 
-        while (utf8_pos < len_bytes) {
-           
-            std::string::size_type inicio_char_utf8 = utf8_pos;
+            UErrorCode status = U_ZERO_ERROR;
 
-            UChar32 c;
+            instance.reset( icu::Collator::createInstance(icu::Locale("pt", "BR"), status) );
 
-            U8_NEXT(utf8_string.c_str(), utf8_pos, len_bytes, c);
+            if ( U_FAILURE(status) ) {
 
-            std::string::size_type bytes_neste_char = utf8_pos - inicio_char_utf8;
-          
-            std::string::size_type u16_neste_char = U16_LENGTH(c);
+                instance.reset();
+
+                std::string error = u_errorName(status);
+
+                throw std::runtime_error("ICU Erro: " + error);
 
-            for (int i = 0; i < bytes_neste_char; ++i) {
-                mapa[inicio_char_utf8 + i] = utf16_pos;
             }
 
-            utf16_pos += u16_neste_char;
         }
 
-        mapa[len_bytes] = utf16_pos;
-
-        return mapa;
+        return *instance;
 
     }
 
     /**
-     * Retorna o índice da primeira ocorrência do padrão informado na string.
+     * Chaves de ordenação de uma lista de palavras, guardadas em um único buffer contíguo.
      *
-     * Esta função busca a primeira ocorrência do padrão (string ou expressão regular) na string de entrada,
-     * retornando o índice correspondente em unidades UTF-16 (compatível com JavaScript).
-     * Inspirada na função search do JavaScript.
+     * A chave da palavra i ocupa os bytes [offsets[i], offsets[i + 1]) de keys e termina com o byte 0,
+     * que não aparece em nenhuma outra posição da chave. Assim, comparar duas chaves com memcmp
+     * até o tamanho da menor dá o mesmo resultado que Collator::compare sobre as palavras.
+     */
+    struct CollationKeys {
+
+        std::vector<uint8_t> keys;
+
+        std::vector<std::size_t> offsets;
+
+        bool less( std::size_t a, std::size_t b ) const {
+
+            std::size_t lengthA = offsets[a + 1] - offsets[a];
+
+            std::size_t lengthB = offsets[b + 1] - offsets[b];
+
+            int result = std::memcmp( keys.data() + offsets[a], keys.data() + offsets[b], std::min(lengthA, lengthB) );
+
+            // Palavras equivalentes mantêm a ordem original, deixando a ordenação estável e determinística.
+            return ( result != 0 ) ? result < 0 : a < b;
+
+        }
+
+    };
+
+    /**
+     * Gera as chaves de ordenação pt-BR de todas as palavras, uma única vez.
      *
-     * @param string String onde será feita a busca.
-     * @param search Padrão a ser buscado (string ou expressão regular).
-     * @return std::string::size_type Índice da primeira ocorrência do padrão, ou std::string::npos se não encontrado.
-     */    
-    std::string::size_type search( const std::string& string, const std::string& search ) {
+     * @param words Palavras (UTF-8).
+     * @return CollationKeys Chaves de todas as palavras, na ordem original.
+     */
+    static CollationKeys buildCollationKeys( const std::vector<std::string>& words ) {
 
-        if(string.empty()) return std::string::npos;
+        const icu::Collator& coll = collator();
 
-        forcaRegex::RegexResult result = forcaRegex::preg_match(search, string);
+        CollationKeys result;
 
-        if(!result.match) return std::string::npos;
+        std::size_t i, size = words.size();
 
-        std::vector<forcaRegex::RegexStructData>* match_data = result.get(0);
+        result.offsets.reserve(size + 1);
 
-        if(match_data == nullptr) return std::string::npos;
+        // Estimativa inicial: as chaves costumam ter poucos bytes a mais que a palavra.
+        result.keys.reserve( size * 16 );
 
-        forcaRegex::RegexStructData first_match = match_data->at(0);
+        result.offsets.push_back(0);
 
-        std::string::size_type index = forcaStrings::IndexUTF8_toUTF16(string, first_match.start);
+        for(i = 0; i < size; i++){
 
-        return index;
+            icu::UnicodeString text = icu::UnicodeString::fromUTF8( icu::StringPiece( words[i].data(), static_cast<int32_t>( words[i].size() ) ) );
+
+            std::size_t start = result.keys.size();
+
+            std::size_t available = static_cast<std::size_t>( text.length() ) * 4 + 16;
+
+            result.keys.resize( start + available );
+
+            int32_t length = coll.getSortKey( text, result.keys.data() + start, static_cast<int32_t>(available) );
+
+            // Quando o espaço não é suficiente, a ICU retorna o tamanho necessário sem escrever a chave inteira.
+            if( static_cast<std::size_t>(length) > available ){
+
+                result.keys.resize( start + length );
+
+                length = coll.getSortKey( text, result.keys.data() + start, length );
+
+            }
+
+            if( length <= 0 ) throw std::runtime_error("ICU Erro: Falha ao gerar a chave de ordenação da palavra \"" + words[i] + "\".");
+
+            result.keys.resize( start + length );
+
+            result.offsets.push_back( result.keys.size() );
+
+        }
+
+        return result;
 
     }
 
     /**
-     * Retorna os índices de todas as ocorrências do padrão informado na string.
+     * Ordena as palavras de acordo com as regras do português do Brasil (collation ICU pt-BR).
      *
-     * Esta função busca todas as ocorrências do padrão (string ou expressão regular) na string de entrada,
-     * retornando um vetor com os índices de cada ocorrência em unidades UTF-16 (compatível com JavaScript).
-     * 
-     * Inspirada na função search do JavaScript, porém searchAll é uma implementação pessoal e não existe nativamente no JS.
+     * A chave de ordenação de cada palavra é gerada uma única vez com um Collator pt-BR reaproveitado
+     * por thread, e a ordenação compara apenas as chaves com memcmp, sem voltar à ICU. Para listas
+     * grandes, os trechos da permutação são ordenados em paralelo e depois intercalados.
+     * Palavras equivalentes mantêm a ordem original.
      *
-     * @param string String onde será feita a busca.
-     * @param search Padrão a ser buscado (string ou expressão regular).
-     * @param limit  (Opcional) Limite máximo de índices a retornar.
-     * @return std::vector<std::string::size_type> Vetor com os índices de todas as ocorrências encontradas.
-     */    
-    std::vector<std::string::size_type> search_all( const std::string& string, const std::string& search, std::size_t limit ) {
+     * @param words Palavras a serem ordenadas (UTF-8). O vetor não é alterado.
+     * @return std::vector<std::size_t> Permutação dos índices: o i-ésimo elemento é o índice, em words,
+     *                                  da i-ésima palavra em ordem alfabética.
+     * @throws std::runtime_error Em caso de erro na biblioteca ICU.
+     */
+    std::vector<std::size_t> collationOrder( const std::vector<std::string>& words ) {
 
-        if(string.empty() || limit == 0) return {};
+        CollationKeys keys = buildCollationKeys(words);
 
-        forcaRegex::RegexResult result = forcaRegex::preg_match_all(search, string, 0, limit);
+        std::size_t i, size = words.size();
 
-        if(!result.match) return {};
+        std::vector<std::size_t> order(size);
 
-        std::vector<forcaRegex::RegexStructData>* match_data = result.get(0);
+        for(i = 0; i < size; i++) order[i] = i;
 
-        if(match_data == nullptr) return {};
+        auto compare = [&keys]( std::size_t a, std::size_t b ){ return keys.less(a, b); };
 
-        std::vector<std::string::size_type> all_index;
+        std::size_t chunks = 1;
 
-        std::size_t i, matchSize = match_data->size();
+        if( size >= COLLATION_PARALLEL_THRESHOLD ){
 
-        std::vector<std::string::size_type> utf16_index = forcaStrings::MapIndexUTF8_toUTF16(string);
+            std::size_t threads = std::thread::hardware_concurrency();
 
-        for(i=0; i<matchSize; i++){
+            chunks = std::max<std::size_t>( 1, std::min( threads, size / (COLLATION_PARALLEL_THRESHOLD / 2) ) );
+
+        }
+
+        if( chunks == 1 ){
 
-            if(i == limit) break;
+            std::sort( order.begin(), order.end(), compare );
 
-            all_index.push_back( utf16_index[ match_data->at(i).start ] );
+            return order;
 
         }
 
-        return all_index;
+        std::vector<std::size_t> bounds(chunks + 1);
+
+        for(i = 0; i <= chunks; i++) bounds[i] = size * i / chunks;
+
+        auto sortChunk = [&]( std::size_t chunk ){
+            std::sort( order.begin() + bounds[chunk], order.begin() + bounds[chunk + 1], compare );
+        };
+
+        std::vector<std::thread> workers;
+
+        workers.reserve(chunks - 1);
+
+        for(i = 1; i < chunks; i++){
+
+            try {
+                workers.emplace_back( sortChunk, i );
+            } catch (const std::system_error&) {
+                // Sem recursos para uma nova thread: o trecho é ordenado na thread atual.
+                sortChunk(i);
+            }
+
+        }
+
+        sortChunk(0);
+
+        for(std::thread& worker : workers) worker.join();
+
+        // Intercala os trechos dois a dois até sobrar apenas um.
+        for(std::size_t width = 1; width < chunks; width *= 2){
+
+            for(i = 0; i + width < chunks; i += 2 * width){
+
+                std::size_t last = std::min( i + 2 * width, chunks );
+
+                std::inplace_merge( order.begin() + bounds[i], order.begin() + bounds[i + width], order.begin() + bounds[last], compare );
+
+            }
+
+        }
+
+        return order;
 
     }
 
@@ -0,0 +1,117 @@
+/*
+|=================================================================
+|              GERADOR DO BUNDLE DE REGEX PRÉ-COMPILADAS
+|=================================================================
+|
+| Executado durante o build (ver CMakeLists.txt). Compila os padrões
+| listados em forcaRegexBuiltins.h, serializa o código compilado com
+| o pcre2_serialize_encode e escreve um arquivo .cpp com os bytes,
+| que é compilado junto com o JogoDaForca.
+|
+| Uso: forcaRegexBundle <arquivo de saída .cpp>
+|=================================================================
+*/
+
+// Faz o programa compilar strings unicode.
+#pragma execution_character_set("utf-8")
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "forcaRegex.h"
+#include "forcaRegexBuiltins.h"
+
+int main(int argc, char* argv[]) {
+
+    if(argc < 2){
+        std::cerr << "Uso: forcaRegexBundle <arquivo de saída .cpp>" << std::endl;
+        return 1;
+    }
+
+    // O bundle guarda somente o código do interpretador, o JIT é compilado ao carregar.
+    forcaRegex::setJITEnabled(false);
+
+    std::vector< std::unique_ptr<forcaRegex::RegexPattern> > patterns;
+
+    std::vector<const pcre2_code*> codes;
+
+    try {
+
+        for( const forcaRegex::PatternLiteral& pattern : forcaRegex::builtins::PATTERNS ){
+
+            patterns.push_back( forcaRegex::createPattern(pattern) );
+
+            codes.push_back( patterns.back()->compiled.code );
+
+        }
+
+    } catch (const std::exception& e) {
+
+        std::cerr << "Erro ao compilar os padrões internos: " << e.what() << std::endl;
+
+        return 1;
+
+    }
+
+    uint8_t *bytes = nullptr;
+
+    PCRE2_SIZE size = 0;
+
+    int32_t result = pcre2_serialize_encode( codes.data(), static_cast<int32_t>( codes.size() ), &bytes, &size, nullptr );
+
+    if(result < 0){
+
+        PCRE2_UCHAR buffer[256];
+
+        pcre2_get_error_message(result, buffer, sizeof(buffer));
+
+        std::cerr << "Erro ao serializar os padrões internos: " << reinterpret_cast<char*>(buffer) << std::endl;
+
+        return 1;
+
+    }
+
+    std::ofstream output( argv[1], std::ios::out | std::ios::trunc );
+
+    if( !output.is_open() ){
+
+        pcre2_serialize_free(bytes);
+
+        std::cerr << "Não foi possível criar o arquivo " << argv[1] << std::endl;
+
+        return 1;
+
+    }
+
+    output << "// Arquivo gerado por tools/forcaRegexBundle.cpp durante o build. NÃO EDITE.\n";
+    output << "#include \"forcaRegexBuiltins.h\"\n\n";
+    output << "namespace forcaRegex {\n\n";
+    output << "    namespace builtins {\n\n";
+    output << "        const unsigned char BUNDLE[] = {";
+
+    char hex[8];
+
+    for( PCRE2_SIZE i = 0; i < size; i++ ){
+
+        if( i % 16 == 0 ) output << "\n            ";
+
+        std::snprintf( hex, sizeof(hex), "0x%02x,", bytes[i] );
+
+        output << hex;
+
+    }
+
+    output << "\n        };\n\n";
+    output << "        const std::size_t BUNDLE_SIZE = " << size << ";\n\n";
+    output << "    }\n\n";
+    output << "}\n";
+
+    pcre2_serialize_free(bytes);
+
+    output.close();
+
+    return output.fail() ? 1 : 0;
+
+}